@@ -0,0 +1,153 @@
+/*
+ * Busca Aproximada por Distância de Edição - implementação (veja aproximada.h)
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "aproximada.h"
+
+#define TAMANHO_LINHA_LOCAL 256
+
+int limitePadraoAproximado(int tamanho) {
+    return tamanho <= 4 ? 1 : (tamanho <= 10 ? 2 : 3);
+}
+
+void prepararPadraoAproximado(PadraoAproximado* padrao, const char* chave) {
+    memset(padrao->mascaras, 0, sizeof(padrao->mascaras));
+    padrao->chave = chave;
+    padrao->tamanho = (int)strlen(chave);
+    for (int i = 0; i < padrao->tamanho && i < TAMANHO_MAX_PADRAO_BITS; i++) {
+        padrao->mascaras[(unsigned char)chave[i]] |= 1ULL << i;
+    }
+}
+
+int distanciaEdicao(const char* a, int tamanhoA, const char* b, int tamanhoB, int limite) {
+    // Nomes comuns cabem na linha da pilha; só textos longos alocam
+    int linhaLocal[TAMANHO_LINHA_LOCAL];
+    int* linha = tamanhoB < TAMANHO_LINHA_LOCAL ? linhaLocal : (int*)malloc((size_t)(tamanhoB + 1) * sizeof(int));
+    if (linha == NULL) {
+        return limite + 1;
+    }
+    for (int j = 0; j <= tamanhoB; j++) {
+        linha[j] = j;
+    }
+
+    for (int i = 1; i <= tamanhoA; i++) {
+        int diagonal = linha[0];   // D[i-1][j-1]
+        int menorDaLinha = i;
+        linha[0] = i;
+        for (int j = 1; j <= tamanhoB; j++) {
+            int acima = linha[j];  // D[i-1][j]
+            int custo = diagonal + (a[i - 1] != b[j - 1]);
+            if (acima + 1 < custo) {
+                custo = acima + 1;
+            }
+            if (linha[j - 1] + 1 < custo) {
+                custo = linha[j - 1] + 1;
+            }
+            linha[j] = custo;
+            diagonal = acima;
+            if (custo < menorDaLinha) {
+                menorDaLinha = custo;
+            }
+        }
+        // Os valores de uma linha nunca ficam menores que o mínimo da anterior
+        if (menorDaLinha > limite) {
+            if (linha != linhaLocal) {
+                free(linha);
+            }
+            return limite + 1;
+        }
+    }
+
+    int distancia = linha[tamanhoB];
+    if (linha != linhaLocal) {
+        free(linha);
+    }
+    return distancia <= limite ? distancia : limite + 1;
+}
+
+/*
+ * Myers/Hyyrö: Pv e Mv guardam as diferenças verticais (+1 e -1) da coluna
+ * atual, um bit por linha do padrão; a pontuação acompanha a última linha
+ */
+int distanciaAproximada(const PadraoAproximado* padrao, const char* texto, int tamanhoTexto, int limite) {
+    int m = padrao->tamanho;
+    int diferencaTamanho = m > tamanhoTexto ? m - tamanhoTexto : tamanhoTexto - m;
+    if (diferencaTamanho > limite) {
+        return limite + 1;
+    }
+    if (m == 0) {
+        return tamanhoTexto;
+    }
+    if (m > TAMANHO_MAX_PADRAO_BITS) {
+        return distanciaEdicao(padrao->chave, m, texto, tamanhoTexto, limite);
+    }
+
+    unsigned long long ultimo = 1ULL << (m - 1);
+    unsigned long long pv = m == 64 ? ~0ULL : (1ULL << m) - 1;
+    unsigned long long mv = 0;
+    int pontuacao = m;
+
+    for (int j = 0; j < tamanhoTexto; j++) {
+        unsigned long long eq = padrao->mascaras[(unsigned char)texto[j]];
+        unsigned long long xv = eq | mv;
+        unsigned long long xh = (((eq & pv) + pv) ^ pv) | eq;
+        unsigned long long ph = mv | ~(xh | pv);
+        unsigned long long mh = pv & xh;
+
+        if (ph & ultimo) {
+            pontuacao++;
+        } else if (mh & ultimo) {
+            pontuacao--;
+        }
+
+        // Cada byte restante baixa a pontuação em no máximo 1
+        if (pontuacao - (tamanhoTexto - 1 - j) > limite) {
+            return limite + 1;
+        }
+
+        // A primeira linha da matriz é D[0][j] = j: a diferença horizontal nela é sempre +1
+        ph = (ph << 1) | 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+    }
+
+    return pontuacao <= limite ? pontuacao : limite + 1;
+}
+
+int buscarAproximados(const void* registros, int n, size_t tamanhoRegistro, size_t deslocamentoChave,
+                      const char* chave, int limite, CandidatoAproximado candidatos[], int maximo) {
+    if (maximo <= 0) {
+        return 0;
+    }
+    PadraoAproximado padrao;
+    prepararPadraoAproximado(&padrao, chave);
+    int total = 0;
+
+    for (int i = 0; i < n; i++) {
+        const char* texto = (const char*)registros + (size_t)i * tamanhoRegistro + deslocamentoChave;
+        // Com a lista cheia, só interessa quem supera o pior guardado
+        int limiteAtual = total == maximo ? candidatos[total - 1].distancia - 1 : limite;
+        if (limiteAtual < 0) {
+            break; // Lista cheia de nomes a distância 0
+        }
+
+        int distancia = distanciaAproximada(&padrao, texto, (int)strlen(texto), limiteAtual);
+        if (distancia > limiteAtual) {
+            continue;
+        }
+
+        // Inserção ordenada na lista (pequena) de candidatos
+        int posicao = total < maximo ? total++ : total - 1;
+        while (posicao > 0 && candidatos[posicao - 1].distancia > distancia) {
+            candidatos[posicao] = candidatos[posicao - 1];
+            posicao--;
+        }
+        candidatos[posicao].indice = i;
+        candidatos[posicao].distancia = distancia;
+    }
+    return total;
+}
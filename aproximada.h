@@ -0,0 +1,68 @@
+/*
+ * Busca Aproximada por Distância de Edição
+ *
+ * Encontra nomes a até k edições (inserção, remoção ou troca de um byte) do
+ * nome procurado, para que "pistla" ache "pistola".
+ *
+ * A distância é calculada pelo algoritmo bit-paralelo de Myers (na forma de
+ * Hyyrö): cada coluna da matriz de programação dinâmica cabe em uma palavra
+ * de 64 bits, então comparar com um nome de n bytes custa n passos de poucas
+ * operações, em vez de m × n células. As máscaras do padrão são montadas uma
+ * vez por consulta, e a varredura descarta antes de começar os nomes cujo
+ * tamanho difere em mais de k, e no meio os que já não podem voltar a k.
+ * Padrões com mais de 64 bytes usam a programação dinâmica comum.
+ *
+ * Compare chaves normalizadas (colacao.h): sem acentos, cada letra é um byte.
+ */
+
+#ifndef APROXIMADA_H
+#define APROXIMADA_H
+
+#include <stddef.h>
+
+#define TAMANHO_MAX_PADRAO_BITS 64   // Padrões maiores caem na programação dinâmica
+
+// Um nome encontrado e sua distância ao padrão
+typedef struct {
+    int indice;
+    int distancia;
+} CandidatoAproximado;
+
+// Padrão preparado para várias comparações
+typedef struct {
+    unsigned long long mascaras[256];   // Bit i ligado em mascaras[c] se padrao[i] == c
+    const char* chave;
+    int tamanho;
+} PadraoAproximado;
+
+/*
+ * Distância tolerada para um padrão de tamanho bytes: 1 até 4, 2 até 10, depois 3
+ */
+int limitePadraoAproximado(int tamanho);
+
+/*
+ * Monta as máscaras do padrão; chave precisa continuar válida durante o uso
+ */
+void prepararPadraoAproximado(PadraoAproximado* padrao, const char* chave);
+
+/*
+ * Distância de edição entre o padrão e o texto, ou limite + 1 se passar do limite
+ */
+int distanciaAproximada(const PadraoAproximado* padrao, const char* texto, int tamanhoTexto, int limite);
+
+/*
+ * Distância de edição pela programação dinâmica comum, linha a linha
+ * Referência para as medições e caminho dos padrões longos
+ */
+int distanciaEdicao(const char* a, int tamanhoA, const char* b, int tamanhoB, int limite);
+
+/*
+ * Varre n registros de tamanhoRegistro bytes cuja chave normalizada fica em
+ * deslocamentoChave (use offsetof) e guarda em candidatos os até maximo mais
+ * próximos a no máximo limite edições, do mais próximo ao mais distante
+ * (empates na ordem dos registros). Retorna quantos candidatos guardou
+ */
+int buscarAproximados(const void* registros, int n, size_t tamanhoRegistro, size_t deslocamentoChave,
+                      const char* chave, int limite, CandidatoAproximado candidatos[], int maximo);
+
+#endif
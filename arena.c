@@ -0,0 +1,92 @@
+/*
+ * Arena de Nomes - implementação (veja arena.h)
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+void inicializarArena(ArenaNomes* arena) {
+    memset(arena, 0, sizeof(ArenaNomes));
+}
+
+void liberarArena(ArenaNomes* arena) {
+    free(arena->dados);
+    memset(arena, 0, sizeof(ArenaNomes));
+}
+
+int reservarArena(ArenaNomes* arena, size_t bytes) {
+    size_t necessario = (size_t)arena->usados + bytes;
+    if (necessario > 0xFFFFFFFFu) {
+        return 0; // Os deslocamentos têm 32 bits
+    }
+    if (necessario <= arena->capacidade) {
+        return 1;
+    }
+
+    size_t capacidade = arena->capacidade > 0 ? arena->capacidade : ARENA_CAPACIDADE_INICIAL;
+    while (capacidade < necessario) {
+        capacidade *= 2;
+    }
+    if (capacidade > 0xFFFFFFFFu) {
+        capacidade = 0xFFFFFFFFu;
+    }
+
+    char* dados = (char*)realloc(arena->dados, capacidade);
+    if (dados == NULL) {
+        return 0;
+    }
+    arena->dados = dados;
+    arena->capacidade = (unsigned int)capacidade;
+    return 1;
+}
+
+int guardarNome(ArenaNomes* arena, const char* texto, size_t tamanho, NomeCompacto* nome) {
+    memset(nome, 0, sizeof(NomeCompacto));
+    if (tamanho <= NOME_CURTO_MAX) {
+        nome->tamanho = (unsigned int)tamanho;
+        memcpy(nome->curto, texto, tamanho);
+        return 1;
+    }
+
+    if (!reservarArena(arena, tamanho + 1)) {
+        return 0;
+    }
+    nome->tamanho = (unsigned int)tamanho;
+    memcpy(nome->longo.prefixo, texto, 4);
+    nome->longo.deslocamento = arena->usados;
+    memcpy(arena->dados + arena->usados, texto, tamanho);
+    arena->dados[arena->usados + tamanho] = '\0';
+    arena->usados += (unsigned int)tamanho + 1;
+    return 1;
+}
+
+void descartarNome(ArenaNomes* arena, const NomeCompacto* nome) {
+    if (nome->tamanho > NOME_CURTO_MAX) {
+        arena->lixo += nome->tamanho + 1;
+    }
+}
+
+const char* textoNome(const ArenaNomes* arena, const NomeCompacto* nome) {
+    return nome->tamanho <= NOME_CURTO_MAX ? nome->curto : arena->dados + nome->longo.deslocamento;
+}
+
+int nomeIgual(const ArenaNomes* arena, const NomeCompacto* nome, const char* texto, size_t tamanho) {
+    if (nome->tamanho != tamanho) {
+        return 0;
+    }
+    if (tamanho <= NOME_CURTO_MAX) {
+        return memcmp(nome->curto, texto, tamanho) == 0;
+    }
+    // O prefixo está no registro: só vai à arena quando ele coincide
+    return memcmp(nome->longo.prefixo, texto, 4) == 0 &&
+           memcmp(arena->dados + nome->longo.deslocamento + 4, texto + 4, tamanho - 4) == 0;
+}
+
+int moverNome(const ArenaNomes* origem, ArenaNomes* destino, NomeCompacto* nome) {
+    if (nome->tamanho <= NOME_CURTO_MAX) {
+        return 1;
+    }
+    return guardarNome(destino, origem->dados + nome->longo.deslocamento, nome->tamanho, nome);
+}
@@ -0,0 +1,82 @@
+/*
+ * Arena de Nomes
+ *
+ * Guarda textos de qualquer tamanho em registros de 16 bytes (NomeCompacto).
+ * Textos de até NOME_CURTO_MAX bytes ficam inteiros dentro do próprio registro;
+ * os maiores ficam em uma arena contígua, indicada por um deslocamento de
+ * 32 bits, e o registro guarda só o tamanho e os 4 primeiros bytes.
+ *
+ * Comparar dois nomes começa pelo tamanho e pelo prefixo, que estão no
+ * registro; a arena só é lida quando os dois coincidem. Como os nomes longos
+ * ficam um atrás do outro, percorrê-los lê memória sequencial.
+ *
+ * Nomes descartados continuam ocupando a arena (viram lixo) até o dono
+ * copiar os vivos para uma arena nova com moverNome(); só o dono sabe onde
+ * estão todos os NomeCompacto que apontam para ela.
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+#define NOME_CURTO_MAX 11       // Bytes guardados no próprio registro (mais o terminador)
+#define ARENA_CAPACIDADE_INICIAL 256
+
+typedef struct {
+    unsigned int tamanho;                 // Bytes do texto, sem o terminador
+    union {
+        char curto[NOME_CURTO_MAX + 1];   // tamanho <= NOME_CURTO_MAX: o texto inteiro
+        struct {
+            char prefixo[4];              // Sobrepõe curto[0..3]
+            unsigned int deslocamento;    // Posição do texto (com terminador) na arena
+            unsigned int reservado;
+        } longo;
+    };
+} NomeCompacto;
+
+typedef struct {
+    char* dados;
+    unsigned int usados;
+    unsigned int capacidade;
+    unsigned int lixo;        // Bytes de nomes descartados
+} ArenaNomes;
+
+void inicializarArena(ArenaNomes* arena);
+
+void liberarArena(ArenaNomes* arena);
+
+/*
+ * Garante espaço para mais bytes sem realocar, dobrando a capacidade
+ * Retorna 0 se faltar memória ou se a arena passaria de 4 GiB
+ */
+int reservarArena(ArenaNomes* arena, size_t bytes);
+
+/*
+ * Guarda os tamanho bytes do texto em *nome
+ * Retorna 0 se faltar memória ou se a arena passaria de 4 GiB
+ */
+int guardarNome(ArenaNomes* arena, const char* texto, size_t tamanho, NomeCompacto* nome);
+
+/*
+ * Marca o espaço do nome na arena como lixo
+ */
+void descartarNome(ArenaNomes* arena, const NomeCompacto* nome);
+
+/*
+ * Texto terminado em zero; vale até a próxima escrita na arena
+ */
+const char* textoNome(const ArenaNomes* arena, const NomeCompacto* nome);
+
+/*
+ * 1 se o nome é igual aos tamanho bytes do texto
+ */
+int nomeIgual(const ArenaNomes* arena, const NomeCompacto* nome, const char* texto, size_t tamanho);
+
+/*
+ * Copia o nome de origem para destino e atualiza *nome (compactação)
+ * Nomes curtos não usam a arena e ficam como estão
+ */
+int moverNome(const ArenaNomes* origem, ArenaNomes* destino, NomeCompacto* nome);
+
+#endif
@@ -7,19 +7,42 @@
  * 
  * O objetivo é comparar o desempenho das duas estruturas de dados
  * e demonstrar a eficiência da busca binária em vetores ordenados.
+ * Cada estrutura tem um filtro de Bloom que descarta nomes ausentes antes
+ * da busca completa.
+ * Ordenação e buscas usam a chave normalizada do nome (colacao.h), sem
+ * diferenciar maiúsculas nem acentos.
+ * Item, filtro de Bloom, tabela e os laços de busca no vetor vêm do motor
+ * compartilhado (inventario.h); compile com make.
+ *
+ * O inventário adaptativo (menu 7) dispensa a escolha: observa o mix de
+ * operações e migra sozinho entre vetor, vetor ordenado, tabela hash e lista
+ * ordenada quando a carga muda; veja avaliarRepresentacao().
+ *
+ * No modo servidor (menu 8 ou ./aventureiro --servidor [caminho]) o inventário
+ * adaptativo atende vários clientes locais por um socket Unix, com um laço
+ * epoll; o programa carga é o gerador de carga que mede vazão e latência.
  */
 
+#define _GNU_SOURCE  // accept4
+
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
+#include <stdarg.h>
 #include <time.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/epoll.h>
 
-// Definição da estrutura Item
-typedef struct {
-    char nome[30];      // Nome do item
-    char tipo[20];      // Tipo do item
-    int quantidade;     // Quantidade do item
-} Item;
+#include "inventario.h"
+#include "metricas.h"
+#include "colacao.h"
+#include "ordenacao.h"
 
 // Definição da estrutura No para lista encadeada
 typedef struct No {
@@ -29,8 +52,64 @@ typedef struct No {
 
 // Constantes do sistema
 #define MAX_ITENS 10
-#define TAMANHO_NOME 30
-#define TAMANHO_TIPO 20
+#define JANELA_ADAPTATIVA 256    // Operações lembradas na janela deslizante
+#define INTERVALO_AVALIACAO 32   // Operações entre duas reavaliações da representação
+#define CUSTO_HASH 3             // Hash do nome e sondagem, em comparações equivalentes
+#define CUSTO_ALOCACAO 4         // malloc/free de um nó da lista, em comparações equivalentes
+#define CUSTO_FIXO_MIGRACAO 64   // Evita migrações seguidas com poucos itens
+#define CHAVES_SIMULACAO 4096    // Nomes distintos usados na simulação de carga
+#define CAMINHO_SOCKET_PADRAO "/tmp/inventario.sock"
+#define MAX_EVENTOS 64           // Eventos tratados por volta do epoll
+#define TAMANHO_LEITURA 65536    // Bytes lidos de uma conexão por evento
+#define MAX_LINHA_PROTOCOLO 1024 // Linha maior que isso encerra a conexão
+#define LIMITE_SAIDA (1 << 20)   // Respostas pendentes acima disso param a leitura da conexão
+
+// Representações do inventário adaptativo
+typedef enum {
+    REPRESENTACAO_VETOR,          // Sem ordem: inserção no fim, busca linear
+    REPRESENTACAO_VETOR_ORDENADO, // Busca binária e percurso em ordem sem ordenar
+    REPRESENTACAO_HASH,           // Vetor + tabela hash: operações pontuais em O(1)
+    REPRESENTACAO_LISTA,          // Lista encadeada ordenada: insere sem deslocar itens
+    TOTAL_REPRESENTACOES
+} Representacao;
+
+typedef enum {
+    OPERACAO_INSERCAO,
+    OPERACAO_REMOCAO,
+    OPERACAO_BUSCA,
+    OPERACAO_PERCURSO,   // Listagem em ordem alfabética
+    TOTAL_OPERACOES
+} TipoOperacao;
+
+// Inventário que troca de representação conforme a carga observada
+typedef struct {
+    Representacao representacao;
+    int adaptar;                 // 0 fixa a representação (usado nas comparações)
+    
+    // Vetor, vetor ordenado e hash guardam os itens em itens[]; a lista, em nós
+    Item* itens;
+    int total;
+    int capacidade;
+    int* tabela;                 // Hash: posição em itens[] ou -1 (sondagem linear)
+    int capacidadeTabela;        // Potência de 2, sempre mais que o dobro de total
+    No* lista;
+    
+    // Janela deslizante das últimas operações
+    unsigned char janela[JANELA_ADAPTATIVA];
+    int posicaoJanela;
+    int operacoesJanela;
+    int contagemJanela[TOTAL_OPERACOES];
+    int operacoesDesdeAvaliacao;
+    double arrependimento[TOTAL_REPRESENTACOES]; // Economia perdida por não estar em cada uma
+    
+    // Estatísticas (custos em comparações equivalentes do modelo)
+    long long operacoes;
+    double custoOperacoes;
+    double custoMigracoes;
+    double tempoMigracoes;       // Segundos
+    int migracoes;
+    int migracoesPara[TOTAL_REPRESENTACOES];
+} InventarioAdaptativo;
 
 // Variáveis globais para o vetor
 Item inventarioVetor[MAX_ITENS];
@@ -41,41 +120,86 @@ int vetorOrdenado = 0; // Flag para indicar se o vetor está ordenado
 No* inicioLista = NULL;
 int totalItensLista = 0;
 
-// Contadores de comparações
-int comparacoesSequencial = 0;
-int comparacoesBinaria = 0;
+// Filtros de Bloom dos nomes de cada estrutura
+FiltroBloom filtroVetor;
+FiltroBloom filtroLista;
+
+// Métricas de comparações (identificadores no registro de metricas.h)
+int metricaSequencial;
+int metricaBinaria;
+
+// Inventário do menu adaptativo
+InventarioAdaptativo inventarioAdaptativo;
 
 // Declaração das funções principais
 void exibirMenuPrincipal();
 void exibirMenuVetor();
 void exibirMenuLista();
-void limparBuffer();
 void resetarContadores();
 void exibirEstatisticas();
 void compararDesempenho();
 void testeDesempenhoAutomatizado();
 
-// Funções para vetor
+// Funções para vetor (as buscas recebem a chave normalizada do nome)
 void inserirItemVetor();
 void removerItemVetor();
 void listarItensVetor();
-int buscarSequencialVetor(char* nome);
+int buscarSequencialVetor(char* chave);
 void ordenarVetor();
-int buscarBinariaVetor(char* nome);
+int buscarBinariaVetor(char* chave);
 
 // Funções para lista encadeada
 void inserirItemLista();
 void removerItemLista();
 void listarItensLista();
-No* buscarSequencialLista(char* nome);
+No* buscarSequencialLista(char* chave);
 void liberarLista();
 
+// Funções do filtro de Bloom (o filtro em si vem de inventario.h)
+void reconstruirBloomVetor();
+void reconstruirBloomLista();
+void exibirEstatisticasBloom(const char* estrutura, const FiltroBloom* filtro);
+int buscarVetorComFiltro(char* nome);
+No* buscarListaComFiltro(char* nome);
+
+// Funções do inventário adaptativo (recebem a chave normalizada do nome)
+void inicializarAdaptativo(InventarioAdaptativo* inv, Representacao representacao, int adaptar);
+void liberarAdaptativo(InventarioAdaptativo* inv);
+int inserirAdaptativo(InventarioAdaptativo* inv, const Item* item);
+int removerAdaptativo(InventarioAdaptativo* inv, const char* chave);
+const Item* buscarAdaptativo(InventarioAdaptativo* inv, const char* chave);
+int percorrerAdaptativo(InventarioAdaptativo* inv, void (*visitar)(const Item*, void*), void* contexto);
+void migrarAdaptativo(InventarioAdaptativo* inv, Representacao destino);
+double custoOperacaoAdaptativa(Representacao representacao, TipoOperacao operacao, int n);
+double custoMigracaoAdaptativa(Representacao origem, Representacao destino, int n);
+const char* nomeRepresentacao(Representacao representacao);
+void exibirMenuAdaptativo();
+void exibirEstatisticasAdaptativo(const InventarioAdaptativo* inv);
+void simularCargaAdaptativa();
+
+// Modo servidor (atende o inventário adaptativo por socket Unix)
+void executarServidor(const char* caminho);
+void iniciarServidorMenu();
+
 /*
  * Função principal do programa
  */
-int main() {
+int main(int argc, char* argv[]) {
     int opcao;
     
+    inicializarBloom(&filtroVetor);
+    inicializarBloom(&filtroLista);
+    inicializarAdaptativo(&inventarioAdaptativo, REPRESENTACAO_VETOR, 1);
+    metricaSequencial = registrarMetrica("busca.sequencial.comparacoes", METRICA_CONTADOR);
+    metricaBinaria = registrarMetrica("busca.binaria.comparacoes", METRICA_CONTADOR);
+    
+    // ./aventureiro --servidor [caminho]: só o servidor, sem menu
+    if (argc > 1 && strcmp(argv[1], "--servidor") == 0) {
+        executarServidor(argc > 2 ? argv[2] : CAMINHO_SOCKET_PADRAO);
+        liberarAdaptativo(&inventarioAdaptativo);
+        return 0;
+    }
+    
     printf("=== SISTEMA DE INVENTÁRIO AVANÇADO - MÓDULO 2 ===\n");
     printf("Comparação entre Vetor e Lista Encadeada\n\n");
     
@@ -114,8 +238,17 @@ int main() {
                 printf("✅ Contadores resetados!\n");
                 break;
             case 7:
+                // Inventário que escolhe a estrutura sozinho
+                exibirMenuAdaptativo();
+                break;
+            case 8:
+                // Atende clientes locais até Enter
+                iniciarServidorMenu();
+                break;
+            case 9:
                 printf("Saindo do sistema... Boa sorte na sobrevivência!\n");
                 liberarLista(); // Libera memória da lista
+                liberarAdaptativo(&inventarioAdaptativo);
                 break;
             default:
                 printf("Opção inválida! Tente novamente.\n");
@@ -123,7 +256,7 @@ int main() {
         
         printf("\n");
         
-    } while(opcao != 7);
+    } while(opcao != 9);
     
     return 0;
 }
@@ -139,33 +272,29 @@ void exibirMenuPrincipal() {
     printf("4. Comparar Desempenho das Estruturas\n");
     printf("5. Executar Teste Automatizado\n");
     printf("6. Resetar Contadores\n");
-    printf("7. Sair\n");
+    printf("7. Inventário Adaptativo (escolhe a estrutura pela carga)\n");
+    printf("8. Modo Servidor (clientes locais por socket Unix)\n");
+    printf("9. Sair\n");
     printf("======================\n");
 }
 
-/*
- * Limpa o buffer de entrada
- */
-void limparBuffer() {
-    int c;
-    while ((c = getchar()) != '\n' && c != EOF);
-}
-
 /*
  * Reseta todos os contadores de comparações
  */
 void resetarContadores() {
-    comparacoesSequencial = 0;
-    comparacoesBinaria = 0;
+    zerarMetricas();
 }
 
 /*
  * Exibe estatísticas de desempenho
  */
 void exibirEstatisticas() {
+    unsigned long long comparacoesSequencial = lerMetrica(metricaSequencial);
+    unsigned long long comparacoesBinaria = lerMetrica(metricaBinaria);
+    
     printf("=== ESTATÍSTICAS DE DESEMPENHO ===\n");
-    printf("Comparações em Busca Sequencial: %d\n", comparacoesSequencial);
-    printf("Comparações em Busca Binária: %d\n", comparacoesBinaria);
+    printf("Comparações em Busca Sequencial: %llu\n", comparacoesSequencial);
+    printf("Comparações em Busca Binária: %llu\n", comparacoesBinaria);
     printf("Total de itens no Vetor: %d\n", totalItensVetor);
     printf("Total de itens na Lista: %d\n", totalItensLista);
     printf("Vetor ordenado: %s\n", vetorOrdenado ? "Sim" : "Não");
@@ -174,6 +303,8 @@ void exibirEstatisticas() {
         float eficiencia = (float)comparacoesBinaria / comparacoesSequencial * 100;
         printf("Eficiência da busca binária: %.2f%% das comparações da busca sequencial\n", eficiencia);
     }
+    exibirEstatisticasBloom("Vetor", &filtroVetor);
+    exibirEstatisticasBloom("Lista", &filtroLista);
     printf("==================================\n");
 }
 
@@ -217,11 +348,13 @@ void exibirMenuLista() {
             case 4: {
                 char nome[TAMANHO_NOME];
                 printf("Digite o nome do item a buscar: ");
-                fgets(nome, TAMANHO_NOME, stdin);
-                nome[strcspn(nome, "\n")] = 0;
+                if (!lerTexto(nome, TAMANHO_NOME)) {
+                    printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+                    break;
+                }
                 
                 resetarContadores();
-                No* resultado = buscarSequencialLista(nome);
+                No* resultado = buscarListaComFiltro(nome);
                 
                 if (resultado != NULL) {
                     printf("✅ Item encontrado!\n");
@@ -231,7 +364,7 @@ void exibirMenuLista() {
                 } else {
                     printf("❌ Item não encontrado!\n");
                 }
-                printf("Comparações realizadas: %d\n", comparacoesSequencial);
+                printf("Comparações realizadas: %llu\n", lerMetrica(metricaSequencial));
                 break;
             }
             case 5:
@@ -266,19 +399,26 @@ void inserirItemLista() {
     
     // Solicita dados do item
     printf("Digite o nome do item: ");
-    fgets(novoNo->dados.nome, TAMANHO_NOME, stdin);
-    novoNo->dados.nome[strcspn(novoNo->dados.nome, "\n")] = 0;
+    if (!lerTexto(novoNo->dados.nome, TAMANHO_NOME)) {
+        printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+        free(novoNo);
+        return;
+    }
     
     // Verifica se o item já existe
-    if (buscarSequencialLista(novoNo->dados.nome) != NULL) {
+    if (buscarListaComFiltro(novoNo->dados.nome) != NULL) {
         printf("⚠️  Item '%s' já existe na lista!\n", novoNo->dados.nome);
         free(novoNo);
         return;
     }
     
     printf("Digite o tipo do item: ");
-    fgets(novoNo->dados.tipo, TAMANHO_TIPO, stdin);
-    novoNo->dados.tipo[strcspn(novoNo->dados.tipo, "\n")] = 0;
+    if (!lerTexto(novoNo->dados.tipo, TAMANHO_TIPO)) {
+        printf("❌ ERRO: Tipo muito longo (máximo %d caracteres)!\n", TAMANHO_TIPO - 1);
+        free(novoNo);
+        return;
+    }
+    prepararChavesItem(&novoNo->dados);
     
     printf("Digite a quantidade: ");
     scanf("%d", &novoNo->dados.quantidade);
@@ -294,6 +434,7 @@ void inserirItemLista() {
     novoNo->proximo = inicioLista;
     inicioLista = novoNo;
     totalItensLista++;
+    adicionarBloom(&filtroLista, novoNo->dados.chaveNome);
     
     printf("✅ Item '%s' adicionado à lista com sucesso!\n", novoNo->dados.nome);
     listarItensLista();
@@ -311,16 +452,27 @@ void removerItemLista() {
     char nome[TAMANHO_NOME];
     printf("=== REMOVER ITEM DA LISTA ===\n");
     printf("Digite o nome do item a ser removido: ");
-    fgets(nome, TAMANHO_NOME, stdin);
-    nome[strcspn(nome, "\n")] = 0;
+    if (!lerTexto(nome, TAMANHO_NOME)) {
+        printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+        return;
+    }
+    char chave[TAMANHO_NOME];
+    normalizarTexto(nome, chave, TAMANHO_NOME);
+    
+    // Nome certamente ausente: nem percorre a lista
+    if (!consultarBloom(&filtroLista, chave)) {
+        printf("❌ Item '%s' não encontrado na lista!\n", nome);
+        return;
+    }
     
     No* atual = inicioLista;
     No* anterior = NULL;
     
     // Busca o item na lista
     while (atual != NULL) {
-        if (strcmp(atual->dados.nome, nome) == 0) {
+        if (strcmp(atual->dados.chaveNome, chave) == 0) {
             // Item encontrado
+            registrarResultadoBloom(&filtroLista, 1);
             printf("Item encontrado: %s (Tipo: %s, Quantidade: %d)\n", 
                    atual->dados.nome, atual->dados.tipo, atual->dados.quantidade);
             
@@ -341,6 +493,9 @@ void removerItemLista() {
                 
                 free(atual);
                 totalItensLista--;
+                if (registrarRemocaoBloom(&filtroLista)) {
+                    reconstruirBloomLista();
+                }
                 printf("✅ Item '%s' removido com sucesso!\n", nome);
                 listarItensLista();
             } else {
@@ -352,6 +507,7 @@ void removerItemLista() {
         atual = atual->proximo;
     }
     
+    registrarResultadoBloom(&filtroLista, 0);
     printf("❌ Item '%s' não encontrado na lista!\n", nome);
 }
 
@@ -368,35 +524,29 @@ void listarItensLista() {
     
     printf("Total de itens: %d/%d\n\n", totalItensLista, MAX_ITENS);
     
-    printf("┌─────┬──────────────────────────────┬────────────────────┬────────────┐\n");
-    printf("│ Pos │ Nome                         │ Tipo               │ Quantidade │\n");
-    printf("├─────┼──────────────────────────────┼────────────────────┼────────────┤\n");
+    imprimirCabecalhoTabela("Pos", "Quantidade");
     
     No* atual = inicioLista;
     int posicao = 1;
     
     while (atual != NULL) {
-        printf("│ %-3d │ %-28s │ %-18s │ %-10d │\n", 
-               posicao, 
-               atual->dados.nome, 
-               atual->dados.tipo, 
-               atual->dados.quantidade);
+        imprimirLinhaTabela(posicao, atual->dados.nome, atual->dados.tipo, atual->dados.quantidade);
         atual = atual->proximo;
         posicao++;
     }
     
-    printf("└─────┴──────────────────────────────┴────────────────────┴────────────┘\n");
+    imprimirRodapeTabela();
 }
 
 /*
- * Busca sequencial na lista encadeada
+ * Busca sequencial na lista encadeada pela chave normalizada do nome
  */
-No* buscarSequencialLista(char* nome) {
+No* buscarSequencialLista(char* chave) {
     No* atual = inicioLista;
     
     while (atual != NULL) {
-        comparacoesSequencial++;
-        if (strcmp(atual->dados.nome, nome) == 0) {
+        CONTAR(metricaSequencial);
+        if (strcmp(atual->dados.chaveNome, chave) == 0) {
             return atual;
         }
         atual = atual->proximo;
@@ -405,6 +555,22 @@ No* buscarSequencialLista(char* nome) {
     return NULL;
 }
 
+/*
+ * Busca sequencial na lista precedida pelo filtro de Bloom
+ * Recebe o nome como digitado e o normaliza uma vez
+ */
+No* buscarListaComFiltro(char* nome) {
+    char chave[TAMANHO_NOME];
+    normalizarTexto(nome, chave, TAMANHO_NOME);
+    if (!consultarBloom(&filtroLista, chave)) {
+        return NULL; // Certamente ausente
+    }
+    
+    No* resultado = buscarSequencialLista(chave);
+    registrarResultadoBloom(&filtroLista, resultado != NULL);
+    return resultado;
+}
+
 /*
  * Libera toda a memória da lista encadeada
  */
@@ -420,6 +586,7 @@ void liberarLista() {
     
     inicioLista = NULL;
     totalItensLista = 0;
+    reconstruirBloomLista();
 }
 
 
@@ -466,11 +633,13 @@ void exibirMenuVetor() {
             case 4: {
                 char nome[TAMANHO_NOME];
                 printf("Digite o nome do item a buscar: ");
-                fgets(nome, TAMANHO_NOME, stdin);
-                nome[strcspn(nome, "\n")] = 0;
+                if (!lerTexto(nome, TAMANHO_NOME)) {
+                    printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+                    break;
+                }
                 
                 resetarContadores();
-                int indice = buscarSequencialVetor(nome);
+                int indice = buscarVetorComFiltro(nome);
                 
                 if (indice != -1) {
                     printf("✅ Item encontrado na posição %d!\n", indice + 1);
@@ -480,7 +649,7 @@ void exibirMenuVetor() {
                 } else {
                     printf("❌ Item não encontrado!\n");
                 }
-                printf("Comparações realizadas: %d\n", comparacoesSequencial);
+                printf("Comparações realizadas: %llu\n", lerMetrica(metricaSequencial));
                 break;
             }
             case 5:
@@ -495,11 +664,20 @@ void exibirMenuVetor() {
                 
                 char nome[TAMANHO_NOME];
                 printf("Digite o nome do item a buscar: ");
-                fgets(nome, TAMANHO_NOME, stdin);
-                nome[strcspn(nome, "\n")] = 0;
+                if (!lerTexto(nome, TAMANHO_NOME)) {
+                    printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+                    break;
+                }
+                
+                char chave[TAMANHO_NOME];
+                normalizarTexto(nome, chave, TAMANHO_NOME);
                 
                 resetarContadores();
-                int indice = buscarBinariaVetor(nome);
+                int indice = -1;
+                if (consultarBloom(&filtroVetor, chave)) {
+                    indice = buscarBinariaVetor(chave);
+                    registrarResultadoBloom(&filtroVetor, indice != -1);
+                }
                 
                 if (indice != -1) {
                     printf("✅ Item encontrado na posição %d!\n", indice + 1);
@@ -509,7 +687,7 @@ void exibirMenuVetor() {
                 } else {
                     printf("❌ Item não encontrado!\n");
                 }
-                printf("Comparações realizadas: %d\n", comparacoesBinaria);
+                printf("Comparações realizadas: %llu\n", lerMetrica(metricaBinaria));
                 break;
             }
             case 7:
@@ -538,18 +716,23 @@ void inserirItemVetor() {
     printf("=== INSERIR ITEM NO VETOR ===\n");
     
     printf("Digite o nome do item: ");
-    fgets(novoItem.nome, TAMANHO_NOME, stdin);
-    novoItem.nome[strcspn(novoItem.nome, "\n")] = 0;
+    if (!lerTexto(novoItem.nome, TAMANHO_NOME)) {
+        printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+        return;
+    }
     
     // Verifica se o item já existe
-    if (buscarSequencialVetor(novoItem.nome) != -1) {
+    if (buscarVetorComFiltro(novoItem.nome) != -1) {
         printf("⚠️  Item '%s' já existe no vetor!\n", novoItem.nome);
         return;
     }
     
     printf("Digite o tipo do item: ");
-    fgets(novoItem.tipo, TAMANHO_TIPO, stdin);
-    novoItem.tipo[strcspn(novoItem.tipo, "\n")] = 0;
+    if (!lerTexto(novoItem.tipo, TAMANHO_TIPO)) {
+        printf("❌ ERRO: Tipo muito longo (máximo %d caracteres)!\n", TAMANHO_TIPO - 1);
+        return;
+    }
+    prepararChavesItem(&novoItem);
     
     printf("Digite a quantidade: ");
     scanf("%d", &novoItem.quantidade);
@@ -563,6 +746,7 @@ void inserirItemVetor() {
     inventarioVetor[totalItensVetor] = novoItem;
     totalItensVetor++;
     vetorOrdenado = 0; // Marca como não ordenado
+    adicionarBloom(&filtroVetor, novoItem.chaveNome);
     
     printf("✅ Item '%s' adicionado ao vetor com sucesso!\n", novoItem.nome);
     listarItensVetor();
@@ -580,10 +764,12 @@ void removerItemVetor() {
     char nome[TAMANHO_NOME];
     printf("=== REMOVER ITEM DO VETOR ===\n");
     printf("Digite o nome do item a ser removido: ");
-    fgets(nome, TAMANHO_NOME, stdin);
-    nome[strcspn(nome, "\n")] = 0;
+    if (!lerTexto(nome, TAMANHO_NOME)) {
+        printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+        return;
+    }
     
-    int indice = buscarSequencialVetor(nome);
+    int indice = buscarVetorComFiltro(nome);
     
     if (indice == -1) {
         printf("❌ Item '%s' não encontrado no vetor!\n", nome);
@@ -608,6 +794,9 @@ void removerItemVetor() {
         
         totalItensVetor--;
         vetorOrdenado = 0; // Marca como não ordenado
+        if (registrarRemocaoBloom(&filtroVetor)) {
+            reconstruirBloomVetor();
+        }
         
         printf("✅ Item '%s' removido com sucesso!\n", nome);
         listarItensVetor();
@@ -630,32 +819,39 @@ void listarItensVetor() {
     printf("Total de itens: %d/%d | Ordenado: %s\n\n", 
            totalItensVetor, MAX_ITENS, vetorOrdenado ? "Sim" : "Não");
     
-    printf("┌─────┬──────────────────────────────┬────────────────────┬────────────┐\n");
-    printf("│ Pos │ Nome                         │ Tipo               │ Quantidade │\n");
-    printf("├─────┼──────────────────────────────┼────────────────────┼────────────┤\n");
-    
+    imprimirCabecalhoTabela("Pos", "Quantidade");
     for (int i = 0; i < totalItensVetor; i++) {
-        printf("│ %-3d │ %-28s │ %-18s │ %-10d │\n", 
-               i + 1, 
-               inventarioVetor[i].nome, 
-               inventarioVetor[i].tipo, 
-               inventarioVetor[i].quantidade);
+        imprimirLinhaTabela(i + 1, inventarioVetor[i].nome, inventarioVetor[i].tipo,
+                            inventarioVetor[i].quantidade);
     }
-    
-    printf("└─────┴──────────────────────────────┴────────────────────┴────────────┘\n");
+    imprimirRodapeTabela();
 }
 
 /*
- * Busca sequencial no vetor
+ * Busca sequencial no vetor pela chave normalizada do nome
  */
-int buscarSequencialVetor(char* nome) {
-    for (int i = 0; i < totalItensVetor; i++) {
-        comparacoesSequencial++;
-        if (strcmp(inventarioVetor[i].nome, nome) == 0) {
-            return i;
-        }
+int buscarSequencialVetor(char* chave) {
+    int comparacoes = 0;
+    int indice = buscaSequencialChave(inventarioVetor, totalItensVetor, sizeof(Item),
+                                      offsetof(Item, chaveNome), chave, &comparacoes);
+    SOMAR(metricaSequencial, comparacoes);
+    return indice;
+}
+
+/*
+ * Busca sequencial no vetor precedida pelo filtro de Bloom
+ * Recebe o nome como digitado e o normaliza uma vez
+ */
+int buscarVetorComFiltro(char* nome) {
+    char chave[TAMANHO_NOME];
+    normalizarTexto(nome, chave, TAMANHO_NOME);
+    if (!consultarBloom(&filtroVetor, chave)) {
+        return -1; // Certamente ausente
     }
-    return -1;
+    
+    int indice = buscarSequencialVetor(chave);
+    registrarResultadoBloom(&filtroVetor, indice != -1);
+    return indice;
 }
 
 /*
@@ -675,7 +871,7 @@ void ordenarVetor() {
     // Bubble Sort
     for (int i = 0; i < totalItensVetor - 1; i++) {
         for (int j = 0; j < totalItensVetor - i - 1; j++) {
-            if (strcmp(inventarioVetor[j].nome, inventarioVetor[j + 1].nome) > 0) {
+            if (strcmp(inventarioVetor[j].chaveNome, inventarioVetor[j + 1].chaveNome) > 0) {
                 // Troca os elementos
                 Item temp = inventarioVetor[j];
                 inventarioVetor[j] = inventarioVetor[j + 1];
@@ -698,28 +894,14 @@ void ordenarVetor() {
 }
 
 /*
- * Busca binária no vetor (requer vetor ordenado)
+ * Busca binária no vetor pela chave normalizada (requer vetor ordenado)
  */
-int buscarBinariaVetor(char* nome) {
-    int esquerda = 0;
-    int direita = totalItensVetor - 1;
-    
-    while (esquerda <= direita) {
-        int meio = esquerda + (direita - esquerda) / 2;
-        comparacoesBinaria++;
-        
-        int comparacao = strcmp(inventarioVetor[meio].nome, nome);
-        
-        if (comparacao == 0) {
-            return meio; // Item encontrado
-        } else if (comparacao < 0) {
-            esquerda = meio + 1; // Busca na metade direita
-        } else {
-            direita = meio - 1; // Busca na metade esquerda
-        }
-    }
-    
-    return -1; // Item não encontrado
+int buscarBinariaVetor(char* chave) {
+    int comparacoes = 0;
+    int indice = buscaBinariaChave(inventarioVetor, totalItensVetor, sizeof(Item),
+                                   offsetof(Item, chaveNome), chave, &comparacoes);
+    SOMAR(metricaBinaria, comparacoes);
+    return indice;
 }
 
 
@@ -742,9 +924,12 @@ void compararDesempenho() {
     printf("├─ Vetor ordenado: %s\n", vetorOrdenado ? "Sim" : "Não");
     printf("└─ Memória da Lista: %d bytes alocados\n", totalItensLista * (int)sizeof(No));
     
+    unsigned long long comparacoesSequencial = lerMetrica(metricaSequencial);
+    unsigned long long comparacoesBinaria = lerMetrica(metricaBinaria);
+    
     printf("\n🔍 COMPARAÇÕES DE BUSCA:\n");
-    printf("├─ Busca Sequencial: %d comparações\n", comparacoesSequencial);
-    printf("├─ Busca Binária: %d comparações\n", comparacoesBinaria);
+    printf("├─ Busca Sequencial: %llu comparações\n", comparacoesSequencial);
+    printf("├─ Busca Binária: %llu comparações\n", comparacoesBinaria);
     
     if (comparacoesSequencial > 0 && comparacoesBinaria > 0) {
         float eficiencia = (float)comparacoesBinaria / comparacoesSequencial * 100;
@@ -769,6 +954,7 @@ void compararDesempenho() {
         printf("├─ Com poucos itens, a diferença de desempenho é mínima\n");
         printf("└─ Adicione mais itens para ver diferenças significativas\n");
     }
+    printf("💡 O inventário adaptativo (opção 7) aplica essas recomendações sozinho\n");
     
     printf("\n================================\n");
 }
@@ -803,6 +989,7 @@ void testeDesempenhoAutomatizado() {
         strcpy(inventarioVetor[i].nome, nomesTeste[i]);
         strcpy(inventarioVetor[i].tipo, tiposTeste[i]);
         inventarioVetor[i].quantidade = quantidadesTeste[i];
+        prepararChavesItem(&inventarioVetor[i]);
         totalItensVetor++;
     }
     
@@ -813,25 +1000,29 @@ void testeDesempenhoAutomatizado() {
             strcpy(novoNo->dados.nome, nomesTeste[i]);
             strcpy(novoNo->dados.tipo, tiposTeste[i]);
             novoNo->dados.quantidade = quantidadesTeste[i];
+            prepararChavesItem(&novoNo->dados);
             novoNo->proximo = inicioLista;
             inicioLista = novoNo;
             totalItensLista++;
         }
     }
     
+    reconstruirBloomVetor();
+    reconstruirBloomLista();
+    
     printf("✅ Dados inseridos: %d itens em cada estrutura\n\n", totalItensVetor);
     
     // Teste de busca sequencial no vetor
     printf("🔍 Testando busca sequencial no vetor...\n");
     resetarContadores();
-    buscarSequencialVetor("Capacete");
-    int compVetor = comparacoesSequencial;
+    buscarSequencialVetor("capacete");
+    int compVetor = (int)lerMetrica(metricaSequencial);
     
     // Teste de busca sequencial na lista
     printf("🔍 Testando busca sequencial na lista...\n");
     resetarContadores();
-    buscarSequencialLista("Capacete");
-    int compLista = comparacoesSequencial;
+    buscarSequencialLista("capacete");
+    int compLista = (int)lerMetrica(metricaSequencial);
     
     // Ordena o vetor e testa busca binária
     printf("🔄 Ordenando vetor...\n");
@@ -839,8 +1030,8 @@ void testeDesempenhoAutomatizado() {
     
     printf("🔍 Testando busca binária no vetor...\n");
     resetarContadores();
-    buscarBinariaVetor("Capacete");
-    int compBinaria = comparacoesBinaria;
+    buscarBinariaVetor("capacete");
+    int compBinaria = (int)lerMetrica(metricaBinaria);
     
     // Exibe resultados
     printf("\n📊 RESULTADOS DO TESTE:\n");
@@ -856,3 +1047,1446 @@ void testeDesempenhoAutomatizado() {
     
     printf("\n================================\n");
 }
+
+
+
+/*
+ * ========================================
+ * INVENTÁRIO ADAPTATIVO
+ * ========================================
+ */
+
+#define MENOR_NOME_ITEM(a, b) (strcmp((a)->chaveNome, (b)->chaveNome) < 0)
+#define MENOR_NOME_PONTEIRO(a, b) (strcmp((*(a))->chaveNome, (*(b))->chaveNome) < 0)
+
+DEFINIR_ORDENACOES(NomeItem, Item, MENOR_NOME_ITEM)
+DEFINIR_ORDENACOES(NomePonteiro, const Item*, MENOR_NOME_PONTEIRO)
+
+const char* nomeRepresentacao(Representacao representacao) {
+    switch (representacao) {
+        case REPRESENTACAO_VETOR: return "Vetor";
+        case REPRESENTACAO_VETOR_ORDENADO: return "Vetor ordenado";
+        case REPRESENTACAO_HASH: return "Tabela hash";
+        case REPRESENTACAO_LISTA: return "Lista ordenada";
+        default: return "?";
+    }
+}
+
+// Quantidade de bits de n: aproxima log2(n + 1) sem depender da libm
+static int bitsAdaptativo(int n) {
+    int bits = 0;
+    while (n >> bits) {
+        bits++;
+    }
+    return bits;
+}
+
+/*
+ * Custo estimado de uma operação com n itens, em comparações equivalentes
+ * Inserções conferem duplicatas, então pagam uma busca completa antes
+ */
+double custoOperacaoAdaptativa(Representacao representacao, TipoOperacao operacao, int n) {
+    double log2n = bitsAdaptativo(n);
+    double percursoOrdenando = n * log2n + n;  // Ordena ponteiros e percorre
+    double custos[TOTAL_REPRESENTACOES][TOTAL_OPERACOES] = {
+        // Inserção                  Remoção                     Busca             Percurso
+        {n + 1.0,                    n / 2.0 + 1,                n / 2.0 + 1,      percursoOrdenando}, // Vetor
+        {log2n + n / 2.0,            log2n + n / 2.0,            log2n,            n},                 // Ordenado
+        {CUSTO_HASH + 1.0,           2.0 * CUSTO_HASH + 1,       CUSTO_HASH,       percursoOrdenando}, // Hash
+        {n / 2.0 + CUSTO_ALOCACAO,   n / 2.0 + CUSTO_ALOCACAO,   n / 2.0 + 1,      n}                  // Lista
+    };
+    return custos[representacao][operacao];
+}
+
+/*
+ * Custo estimado de converter n itens de uma representação para outra
+ */
+double custoMigracaoAdaptativa(Representacao origem, Representacao destino, int n) {
+    double log2n = bitsAdaptativo(n);
+    int ordenado = origem == REPRESENTACAO_VETOR_ORDENADO || origem == REPRESENTACAO_LISTA;
+    double custo = CUSTO_FIXO_MIGRACAO;
+
+    if (origem == REPRESENTACAO_LISTA) {
+        custo += n * (1.0 + CUSTO_ALOCACAO); // Copia cada nó para o vetor e o libera
+    }
+    if ((destino == REPRESENTACAO_VETOR_ORDENADO || destino == REPRESENTACAO_LISTA) && !ordenado) {
+        custo += n * log2n;
+    }
+    if (destino == REPRESENTACAO_HASH) {
+        custo += n * (double)CUSTO_HASH;
+    } else if (destino == REPRESENTACAO_LISTA) {
+        custo += n * (double)CUSTO_ALOCACAO;
+    }
+    return custo;
+}
+
+void inicializarAdaptativo(InventarioAdaptativo* inv, Representacao representacao, int adaptar) {
+    memset(inv, 0, sizeof(InventarioAdaptativo));
+    inv->representacao = representacao;
+    inv->adaptar = adaptar;
+}
+
+void liberarAdaptativo(InventarioAdaptativo* inv) {
+    No* atual = inv->lista;
+    while (atual != NULL) {
+        No* proximo = atual->proximo;
+        free(atual);
+        atual = proximo;
+    }
+    free(inv->itens);
+    free(inv->tabela);
+    inicializarAdaptativo(inv, inv->representacao, inv->adaptar);
+}
+
+static int garantirCapacidadeAdaptativa(InventarioAdaptativo* inv, int minimo) {
+    if (minimo <= inv->capacidade) {
+        return 1;
+    }
+    int capacidade = inv->capacidade > 0 ? inv->capacidade * 2 : 16;
+    while (capacidade < minimo) {
+        capacidade *= 2;
+    }
+    Item* itens = (Item*)realloc(inv->itens, (size_t)capacidade * sizeof(Item));
+    if (itens == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return 0;
+    }
+    inv->itens = itens;
+    inv->capacidade = capacidade;
+    return 1;
+}
+
+/*
+ * Vaga da chave na tabela hash, ou a vaga livre onde ela entraria
+ */
+static int vagaHashAdaptativa(const InventarioAdaptativo* inv, const char* chave) {
+    int mascara = inv->capacidadeTabela - 1;
+    int vaga = (int)(hashNome(chave) & (unsigned long long)mascara);
+    while (inv->tabela[vaga] != -1 && strcmp(inv->itens[inv->tabela[vaga]].chaveNome, chave) != 0) {
+        vaga = (vaga + 1) & mascara;
+    }
+    return vaga;
+}
+
+/*
+ * Refaz a tabela hash sobre itens[] com folga para crescer
+ */
+static int reconstruirTabelaAdaptativa(InventarioAdaptativo* inv) {
+    int capacidade = 16;
+    while (capacidade < 2 * (inv->total + 1)) {
+        capacidade *= 2;
+    }
+    int* tabela = (int*)malloc((size_t)capacidade * sizeof(int));
+    if (tabela == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return 0;
+    }
+    memset(tabela, 0xFF, (size_t)capacidade * sizeof(int)); // Todas as vagas em -1
+
+    free(inv->tabela);
+    inv->tabela = tabela;
+    inv->capacidadeTabela = capacidade;
+    for (int i = 0; i < inv->total; i++) {
+        inv->tabela[vagaHashAdaptativa(inv, inv->itens[i].chaveNome)] = i;
+    }
+    return 1;
+}
+
+/*
+ * Esvazia a vaga sem deixar marcador: os itens seguintes da mesma sequência
+ * de sondagem voltam uma posição quando a vaga ideal deles permite
+ */
+static void apagarVagaHashAdaptativa(InventarioAdaptativo* inv, int vaga) {
+    int mascara = inv->capacidadeTabela - 1;
+    int proxima = vaga;
+
+    inv->tabela[vaga] = -1;
+    for (;;) {
+        proxima = (proxima + 1) & mascara;
+        if (inv->tabela[proxima] == -1) {
+            return;
+        }
+        int ideal = (int)(hashNome(inv->itens[inv->tabela[proxima]].chaveNome) & (unsigned long long)mascara);
+        if (((proxima - ideal) & mascara) >= ((proxima - vaga) & mascara)) {
+            inv->tabela[vaga] = inv->tabela[proxima];
+            inv->tabela[proxima] = -1;
+            vaga = proxima;
+        }
+    }
+}
+
+// Primeira posição do vetor ordenado com chave >= chave
+static int limiteInferiorAdaptativo(const InventarioAdaptativo* inv, const char* chave) {
+    int esquerda = 0;
+    int direita = inv->total;
+    while (esquerda < direita) {
+        int meio = esquerda + (direita - esquerda) / 2;
+        if (strcmp(inv->itens[meio].chaveNome, chave) < 0) {
+            esquerda = meio + 1;
+        } else {
+            direita = meio;
+        }
+    }
+    return esquerda;
+}
+
+// Elo da lista ordenada onde a chave está ou entraria
+static No** eloListaAdaptativa(InventarioAdaptativo* inv, const char* chave) {
+    No** elo = &inv->lista;
+    while (*elo != NULL && strcmp((*elo)->dados.chaveNome, chave) < 0) {
+        elo = &(*elo)->proximo;
+    }
+    return elo;
+}
+
+// Posição da chave em itens[] (vetor, vetor ordenado e hash) ou -1
+static int posicaoAdaptativa(const InventarioAdaptativo* inv, const char* chave) {
+    switch (inv->representacao) {
+        case REPRESENTACAO_VETOR_ORDENADO: {
+            int posicao = limiteInferiorAdaptativo(inv, chave);
+            return posicao < inv->total && strcmp(inv->itens[posicao].chaveNome, chave) == 0 ? posicao : -1;
+        }
+        case REPRESENTACAO_HASH:
+            return inv->tabela[vagaHashAdaptativa(inv, chave)];
+        default: {
+            int comparacoes = 0;
+            return buscaSequencialChave(inv->itens, inv->total, sizeof(Item), offsetof(Item, chaveNome),
+                                        chave, &comparacoes);
+        }
+    }
+}
+
+/*
+ * Converte o inventário para outra representação
+ * Os itens passam primeiro pelo vetor denso (a lista sai dele já em ordem)
+ * e dali é montado o destino; se faltar memória, fica numa representação
+ * que já está pronta
+ */
+void migrarAdaptativo(InventarioAdaptativo* inv, Representacao destino) {
+    Representacao origem = inv->representacao;
+    if (origem == destino) {
+        return;
+    }
+
+    clock_t inicio = clock();
+    double custo = custoMigracaoAdaptativa(origem, destino, inv->total);
+    int ordenado = origem == REPRESENTACAO_VETOR_ORDENADO || origem == REPRESENTACAO_LISTA;
+
+    if (origem == REPRESENTACAO_LISTA) {
+        if (!garantirCapacidadeAdaptativa(inv, inv->total)) {
+            return;
+        }
+        int i = 0;
+        No* atual = inv->lista;
+        while (atual != NULL) {
+            No* proximo = atual->proximo;
+            inv->itens[i++] = atual->dados;
+            free(atual);
+            atual = proximo;
+        }
+        inv->lista = NULL;
+    } else if (origem == REPRESENTACAO_HASH) {
+        free(inv->tabela);
+        inv->tabela = NULL;
+        inv->capacidadeTabela = 0;
+    }
+
+    if ((destino == REPRESENTACAO_VETOR_ORDENADO || destino == REPRESENTACAO_LISTA) && !ordenado) {
+        ordenarQuickNomeItem(inv->itens, inv->total);
+        ordenado = 1;
+    }
+
+    if (destino == REPRESENTACAO_HASH && !reconstruirTabelaAdaptativa(inv)) {
+        destino = ordenado ? REPRESENTACAO_VETOR_ORDENADO : REPRESENTACAO_VETOR;
+    } else if (destino == REPRESENTACAO_LISTA) {
+        // Monta de trás para frente: cada nó entra no início
+        No* lista = NULL;
+        int i;
+        for (i = inv->total - 1; i >= 0; i--) {
+            No* novoNo = (No*)malloc(sizeof(No));
+            if (novoNo == NULL) {
+                break;
+            }
+            novoNo->dados = inv->itens[i];
+            novoNo->proximo = lista;
+            lista = novoNo;
+        }
+        if (i >= 0) {
+            printf("❌ ERRO: Falha na alocação de memória!\n");
+            while (lista != NULL) {
+                No* proximo = lista->proximo;
+                free(lista);
+                lista = proximo;
+            }
+            destino = REPRESENTACAO_VETOR_ORDENADO;
+        } else {
+            inv->lista = lista;
+            free(inv->itens);
+            inv->itens = NULL;
+            inv->capacidade = 0;
+        }
+    }
+
+    inv->representacao = destino;
+    inv->migracoes++;
+    inv->migracoesPara[destino]++;
+    inv->custoMigracoes += custo;
+    inv->tempoMigracoes += ((double)(clock() - inicio)) / CLOCKS_PER_SEC;
+    for (int r = 0; r < TOTAL_REPRESENTACOES; r++) {
+        inv->arrependimento[r] = 0.0;
+    }
+}
+
+/*
+ * Decide se vale migrar, como no problema do aluguel de esquis
+ * O custo do mix da janela é estimado em cada representação; a diferença
+ * para a atual, proporcional ao último intervalo, acumula como arrependimento
+ * (e volta a zero quando a atual passa a ganhar). Só quando o arrependimento
+ * paga a migração a estrutura é convertida: no pior caso o total gasto fica
+ * em cerca do dobro do que se gastaria conhecendo a carga de antemão, e
+ * oscilações curtas da carga não provocam migrações
+ */
+static void avaliarRepresentacao(InventarioAdaptativo* inv) {
+    double custoJanela[TOTAL_REPRESENTACOES];
+    for (int r = 0; r < TOTAL_REPRESENTACOES; r++) {
+        custoJanela[r] = 0.0;
+        for (int op = 0; op < TOTAL_OPERACOES; op++) {
+            custoJanela[r] += inv->contagemJanela[op] * custoOperacaoAdaptativa((Representacao)r,
+                                                                              (TipoOperacao)op, inv->total);
+        }
+    }
+
+    Representacao atual = inv->representacao;
+    int destino = -1;
+    for (int r = 0; r < TOTAL_REPRESENTACOES; r++) {
+        if (r == (int)atual) {
+            continue;
+        }
+        double economia = (custoJanela[atual] - custoJanela[r]) * INTERVALO_AVALIACAO / inv->operacoesJanela;
+        inv->arrependimento[r] += economia;
+        if (inv->arrependimento[r] < 0.0) {
+            inv->arrependimento[r] = 0.0;
+        }
+
+        // Entre as que já pagariam a migração, fica a mais barata para a carga
+        if (inv->arrependimento[r] >= custoMigracaoAdaptativa(atual, (Representacao)r, inv->total) &&
+            (destino == -1 || custoJanela[r] < custoJanela[destino])) {
+            destino = r;
+        }
+    }
+
+    if (destino != -1) {
+        migrarAdaptativo(inv, (Representacao)destino);
+    }
+}
+
+/*
+ * Registra a operação na janela e, a cada INTERVALO_AVALIACAO, reavalia a
+ * representação; chamada antes de executar a operação, que já roda na
+ * representação escolhida
+ */
+static void registrarOperacaoAdaptativa(InventarioAdaptativo* inv, TipoOperacao operacao) {
+    // A operação mais antiga sai da janela
+    if (inv->operacoesJanela == JANELA_ADAPTATIVA) {
+        inv->contagemJanela[inv->janela[inv->posicaoJanela]]--;
+    } else {
+        inv->operacoesJanela++;
+    }
+    inv->janela[inv->posicaoJanela] = (unsigned char)operacao;
+    inv->posicaoJanela = (inv->posicaoJanela + 1) % JANELA_ADAPTATIVA;
+    inv->contagemJanela[operacao]++;
+
+    if (inv->adaptar && ++inv->operacoesDesdeAvaliacao >= INTERVALO_AVALIACAO) {
+        inv->operacoesDesdeAvaliacao = 0;
+        avaliarRepresentacao(inv);
+    }
+
+    inv->operacoes++;
+    inv->custoOperacoes += custoOperacaoAdaptativa(inv->representacao, operacao, inv->total);
+}
+
+/*
+ * Insere uma cópia do item (com as chaves já preparadas)
+ * Retorna 1 se inseriu, 0 se o nome já existia e -1 se faltou memória
+ */
+int inserirAdaptativo(InventarioAdaptativo* inv, const Item* item) {
+    registrarOperacaoAdaptativa(inv, OPERACAO_INSERCAO);
+    const char* chave = item->chaveNome;
+
+    switch (inv->representacao) {
+        case REPRESENTACAO_LISTA: {
+            No** elo = eloListaAdaptativa(inv, chave);
+            if (*elo != NULL && strcmp((*elo)->dados.chaveNome, chave) == 0) {
+                return 0;
+            }
+            No* novoNo = (No*)malloc(sizeof(No));
+            if (novoNo == NULL) {
+                printf("❌ ERRO: Falha na alocação de memória!\n");
+                return -1;
+            }
+            novoNo->dados = *item;
+            novoNo->proximo = *elo;
+            *elo = novoNo;
+            break;
+        }
+        case REPRESENTACAO_VETOR_ORDENADO: {
+            int posicao = limiteInferiorAdaptativo(inv, chave);
+            if (posicao < inv->total && strcmp(inv->itens[posicao].chaveNome, chave) == 0) {
+                return 0;
+            }
+            if (!garantirCapacidadeAdaptativa(inv, inv->total + 1)) {
+                return -1;
+            }
+            memmove(&inv->itens[posicao + 1], &inv->itens[posicao],
+                    (size_t)(inv->total - posicao) * sizeof(Item));
+            inv->itens[posicao] = *item;
+            break;
+        }
+        case REPRESENTACAO_HASH: {
+            int vaga = vagaHashAdaptativa(inv, chave);
+            if (inv->tabela[vaga] != -1) {
+                return 0;
+            }
+            if (!garantirCapacidadeAdaptativa(inv, inv->total + 1)) {
+                return -1;
+            }
+            inv->itens[inv->total] = *item;
+            if (2 * (inv->total + 1) > inv->capacidadeTabela) {
+                inv->total++;
+                if (!reconstruirTabelaAdaptativa(inv)) {
+                    inv->total--;
+                    return -1;
+                }
+                return 1;
+            }
+            inv->tabela[vaga] = inv->total;
+            break;
+        }
+        default:
+            if (posicaoAdaptativa(inv, chave) != -1) {
+                return 0;
+            }
+            if (!garantirCapacidadeAdaptativa(inv, inv->total + 1)) {
+                return -1;
+            }
+            inv->itens[inv->total] = *item;
+            break;
+    }
+
+    inv->total++;
+    return 1;
+}
+
+/*
+ * Remove o item com a chave; retorna 1 se ele existia
+ */
+int removerAdaptativo(InventarioAdaptativo* inv, const char* chave) {
+    registrarOperacaoAdaptativa(inv, OPERACAO_REMOCAO);
+
+    switch (inv->representacao) {
+        case REPRESENTACAO_LISTA: {
+            No** elo = eloListaAdaptativa(inv, chave);
+            if (*elo == NULL || strcmp((*elo)->dados.chaveNome, chave) != 0) {
+                return 0;
+            }
+            No* removido = *elo;
+            *elo = removido->proximo;
+            free(removido);
+            break;
+        }
+        case REPRESENTACAO_VETOR_ORDENADO: {
+            int posicao = posicaoAdaptativa(inv, chave);
+            if (posicao == -1) {
+                return 0;
+            }
+            memmove(&inv->itens[posicao], &inv->itens[posicao + 1],
+                    (size_t)(inv->total - posicao - 1) * sizeof(Item));
+            break;
+        }
+        case REPRESENTACAO_HASH: {
+            int vaga = vagaHashAdaptativa(inv, chave);
+            int posicao = inv->tabela[vaga];
+            if (posicao == -1) {
+                return 0;
+            }
+            apagarVagaHashAdaptativa(inv, vaga);
+
+            // O último item ocupa a posição liberada
+            int ultimo = inv->total - 1;
+            if (posicao != ultimo) {
+                inv->tabela[vagaHashAdaptativa(inv, inv->itens[ultimo].chaveNome)] = posicao;
+                inv->itens[posicao] = inv->itens[ultimo];
+            }
+            break;
+        }
+        default: {
+            int posicao = posicaoAdaptativa(inv, chave);
+            if (posicao == -1) {
+                return 0;
+            }
+            inv->itens[posicao] = inv->itens[inv->total - 1];
+            break;
+        }
+    }
+
+    inv->total--;
+    return 1;
+}
+
+/*
+ * Retorna o item com a chave ou NULL
+ * O ponteiro vale só até a próxima operação, que pode migrar a estrutura
+ */
+const Item* buscarAdaptativo(InventarioAdaptativo* inv, const char* chave) {
+    registrarOperacaoAdaptativa(inv, OPERACAO_BUSCA);
+
+    if (inv->representacao == REPRESENTACAO_LISTA) {
+        No* no = *eloListaAdaptativa(inv, chave);
+        return no != NULL && strcmp(no->dados.chaveNome, chave) == 0 ? &no->dados : NULL;
+    }
+    int posicao = posicaoAdaptativa(inv, chave);
+    return posicao != -1 ? &inv->itens[posicao] : NULL;
+}
+
+/*
+ * Visita os itens em ordem alfabética; retorna quantos foram visitados
+ * Vetor e hash não guardam ordem: ordenam ponteiros a cada percurso
+ */
+int percorrerAdaptativo(InventarioAdaptativo* inv, void (*visitar)(const Item*, void*), void* contexto) {
+    registrarOperacaoAdaptativa(inv, OPERACAO_PERCURSO);
+
+    if (inv->representacao == REPRESENTACAO_LISTA) {
+        for (No* atual = inv->lista; atual != NULL; atual = atual->proximo) {
+            visitar(&atual->dados, contexto);
+        }
+        return inv->total;
+    }
+    if (inv->representacao == REPRESENTACAO_VETOR_ORDENADO) {
+        for (int i = 0; i < inv->total; i++) {
+            visitar(&inv->itens[i], contexto);
+        }
+        return inv->total;
+    }
+
+    const Item** ordem = (const Item**)malloc((size_t)(inv->total > 0 ? inv->total : 1) * sizeof(const Item*));
+    if (ordem == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return 0;
+    }
+    for (int i = 0; i < inv->total; i++) {
+        ordem[i] = &inv->itens[i];
+    }
+    ordenarQuickNomePonteiro(ordem, inv->total);
+    for (int i = 0; i < inv->total; i++) {
+        visitar(ordem[i], contexto);
+    }
+    free(ordem);
+    return inv->total;
+}
+
+/*
+ * Exibe a representação atual, o mix da janela e o custo das migrações
+ */
+void exibirEstatisticasAdaptativo(const InventarioAdaptativo* inv) {
+    const char* nomesOperacoes[TOTAL_OPERACOES] = {"Inserções", "Remoções", "Buscas", "Percursos em ordem"};
+
+    printf("=== ESTATÍSTICAS DO INVENTÁRIO ADAPTATIVO ===\n");
+    printf("Representação atual: %s | Itens: %d\n", nomeRepresentacao(inv->representacao), inv->total);
+
+    printf("\n📊 JANELA (últimas %d operações):\n", inv->operacoesJanela);
+    for (int op = 0; op < TOTAL_OPERACOES; op++) {
+        printf("%s %s: %d (%.1f%%)\n", op == TOTAL_OPERACOES - 1 ? "└─" : "├─", nomesOperacoes[op],
+               inv->contagemJanela[op],
+               inv->operacoesJanela > 0 ? 100.0 * inv->contagemJanela[op] / inv->operacoesJanela : 0.0);
+    }
+
+    printf("\n💰 CUSTO ESTIMADO POR OPERAÇÃO NESTA JANELA (comparações equivalentes):\n");
+    for (int r = 0; r < TOTAL_REPRESENTACOES; r++) {
+        double custo = 0.0;
+        for (int op = 0; op < TOTAL_OPERACOES; op++) {
+            custo += inv->contagemJanela[op] * custoOperacaoAdaptativa((Representacao)r, (TipoOperacao)op,
+                                                                       inv->total);
+        }
+        printf("%s %s: %.1f", r == TOTAL_REPRESENTACOES - 1 ? "└─" : "├─", nomeRepresentacao((Representacao)r),
+               inv->operacoesJanela > 0 ? custo / inv->operacoesJanela : 0.0);
+        if (r == (int)inv->representacao) {
+            printf(" ← atual\n");
+        } else {
+            printf(" | arrependimento %.0f de %.0f para migrar\n", inv->arrependimento[r],
+                   custoMigracaoAdaptativa(inv->representacao, (Representacao)r, inv->total));
+        }
+    }
+
+    double custoTotal = inv->custoOperacoes + inv->custoMigracoes;
+    printf("\n🔀 MIGRAÇÕES: %d\n", inv->migracoes);
+    for (int r = 0; r < TOTAL_REPRESENTACOES; r++) {
+        printf("├─ Para %s: %d\n", nomeRepresentacao((Representacao)r), inv->migracoesPara[r]);
+    }
+    printf("├─ Custo das migrações: %.0f (%.6f segundos)\n", inv->custoMigracoes, inv->tempoMigracoes);
+    printf("├─ Custo das %lld operações: %.0f\n", inv->operacoes, inv->custoOperacoes);
+    printf("└─ Amortizado: migrações são %.1f%% do custo, %.2f por operação\n",
+           custoTotal > 0 ? 100.0 * inv->custoMigracoes / custoTotal : 0.0,
+           inv->operacoes > 0 ? inv->custoMigracoes / inv->operacoes : 0.0);
+    printf("=============================================\n");
+}
+
+// Linha da tabela para cada item visitado em ordem
+static void exibirItemAdaptativo(const Item* item, void* contexto) {
+    int* ordem = (int*)contexto;
+    imprimirLinhaTabela(++(*ordem), item->nome, item->tipo, item->quantidade);
+}
+
+// Lê um nome e calcula a chave normalizada; retorna 0 se o nome não coube
+static int lerChaveAdaptativa(const char* pergunta, char nome[], char chave[]) {
+    printf("%s", pergunta);
+    if (!lerTexto(nome, TAMANHO_NOME)) {
+        printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+        return 0;
+    }
+    normalizarTexto(nome, chave, TAMANHO_NOME);
+    return 1;
+}
+
+/*
+ * Exibe o menu do inventário adaptativo
+ */
+void exibirMenuAdaptativo() {
+    InventarioAdaptativo* inv = &inventarioAdaptativo;
+    int opcao;
+
+    do {
+        printf("=== INVENTÁRIO ADAPTATIVO ===\n");
+        printf("1. Inserir item\n");
+        printf("2. Remover item\n");
+        printf("3. Buscar item\n");
+        printf("4. Listar em ordem alfabética\n");
+        printf("5. Estatísticas da adaptação\n");
+        printf("6. Simular mudanças de carga (compara com estruturas fixas)\n");
+        printf("7. Voltar ao menu principal\n");
+        printf("=============================\n");
+        printf("Status: %d itens | Representação: %s\n", inv->total, nomeRepresentacao(inv->representacao));
+        printf("Escolha uma opção: ");
+        scanf("%d", &opcao);
+        limparBuffer();
+
+        printf("\n");
+
+        switch(opcao) {
+            case 1: {
+                Item novoItem;
+                printf("=== INSERIR ITEM ===\n");
+                printf("Digite o nome do item: ");
+                if (!lerTexto(novoItem.nome, TAMANHO_NOME)) {
+                    printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+                    break;
+                }
+                printf("Digite o tipo do item: ");
+                if (!lerTexto(novoItem.tipo, TAMANHO_TIPO)) {
+                    printf("❌ ERRO: Tipo muito longo (máximo %d caracteres)!\n", TAMANHO_TIPO - 1);
+                    break;
+                }
+                printf("Digite a quantidade: ");
+                scanf("%d", &novoItem.quantidade);
+                limparBuffer();
+
+                if (novoItem.quantidade <= 0) {
+                    printf("❌ ERRO: Quantidade deve ser maior que zero!\n");
+                    break;
+                }
+                prepararChavesItem(&novoItem);
+
+                int resultado = inserirAdaptativo(inv, &novoItem);
+                if (resultado == 1) {
+                    printf("✅ Item '%s' adicionado!\n", novoItem.nome);
+                } else if (resultado == 0) {
+                    printf("⚠️  Item '%s' já existe!\n", novoItem.nome);
+                }
+                break;
+            }
+            case 2: {
+                char nome[TAMANHO_NOME];
+                char chave[TAMANHO_NOME];
+                if (!lerChaveAdaptativa("Digite o nome do item a ser removido: ", nome, chave)) {
+                    break;
+                }
+                if (removerAdaptativo(inv, chave)) {
+                    printf("✅ Item '%s' removido com sucesso!\n", nome);
+                } else {
+                    printf("❌ Item '%s' não encontrado!\n", nome);
+                }
+                break;
+            }
+            case 3: {
+                char nome[TAMANHO_NOME];
+                char chave[TAMANHO_NOME];
+                if (!lerChaveAdaptativa("Digite o nome do item a buscar: ", nome, chave)) {
+                    break;
+                }
+                const Item* item = buscarAdaptativo(inv, chave);
+                if (item != NULL) {
+                    printf("✅ Item encontrado!\n");
+                    printf("Nome: %s\n", item->nome);
+                    printf("Tipo: %s\n", item->tipo);
+                    printf("Quantidade: %d\n", item->quantidade);
+                } else {
+                    printf("❌ Item não encontrado!\n");
+                }
+                break;
+            }
+            case 4: {
+                printf("=== INVENTÁRIO ADAPTATIVO (%s) ===\n", nomeRepresentacao(inv->representacao));
+                imprimirCabecalhoTabela("Nº", "Quantidade");
+                int ordem = 0;
+                percorrerAdaptativo(inv, exibirItemAdaptativo, &ordem);
+                imprimirRodapeTabela();
+                break;
+            }
+            case 5:
+                exibirEstatisticasAdaptativo(inv);
+                break;
+            case 6:
+                simularCargaAdaptativa();
+                break;
+            case 7:
+                printf("Voltando ao menu principal...\n");
+                break;
+            default:
+                printf("Opção inválida!\n");
+        }
+
+        printf("\n");
+
+    } while(opcao != 7);
+}
+
+// Fase da simulação: porcentagem de cada operação
+typedef struct {
+    const char* nome;
+    int percentuais[TOTAL_OPERACOES];  // Inserção, remoção, busca, percurso
+} FaseCarga;
+
+static const FaseCarga fasesCarga[] = {
+    {"Carga inicial", {90, 0, 10, 0}},
+    {"Consultas pontuais", {3, 2, 95, 0}},
+    {"Relatórios em ordem", {5, 5, 88, 2}},
+    {"Rotatividade", {50, 50, 0, 0}}
+};
+#define TOTAL_FASES_CARGA ((int)(sizeof(fasesCarga) / sizeof(fasesCarga[0])))
+
+// Soma as quantidades visitadas, para o percurso não ser descartado
+static void somarQuantidadeAdaptativa(const Item* item, void* contexto) {
+    *(long long*)contexto += item->quantidade;
+}
+
+/*
+ * Executa a sequência de operações de todas as fases num inventário
+ * Guarda o tempo de cada fase e a representação ao fim dela; retorna um
+ * resumo dos resultados, que deve ser igual em todas as representações
+ */
+static long long executarCargaAdaptativa(InventarioAdaptativo* inv, const unsigned char operacoes[],
+                                         const int chaves[], int operacoesPorFase, const Item modelos[],
+                                         double tempos[], Representacao finais[], int migracoesFase[]) {
+    long long resumo = 0;
+    for (int f = 0; f < TOTAL_FASES_CARGA; f++) {
+        int migracoesAntes = inv->migracoes;
+        clock_t inicio = clock();
+        for (int i = f * operacoesPorFase; i < (f + 1) * operacoesPorFase; i++) {
+            const Item* modelo = &modelos[chaves[i]];
+            switch (operacoes[i]) {
+                case OPERACAO_INSERCAO:
+                    resumo += inserirAdaptativo(inv, modelo);
+                    break;
+                case OPERACAO_REMOCAO:
+                    resumo += 2 * removerAdaptativo(inv, modelo->chaveNome);
+                    break;
+                case OPERACAO_BUSCA:
+                    resumo += 3 * (buscarAdaptativo(inv, modelo->chaveNome) != NULL);
+                    break;
+                default: {
+                    long long soma = 0;
+                    percorrerAdaptativo(inv, somarQuantidadeAdaptativa, &soma);
+                    resumo += soma;
+                    break;
+                }
+            }
+        }
+        tempos[f] = ((double)(clock() - inicio)) / CLOCKS_PER_SEC;
+        finais[f] = inv->representacao;
+        migracoesFase[f] = inv->migracoes - migracoesAntes;
+    }
+    return resumo;
+}
+
+/*
+ * Roda a mesma sequência de fases no inventário adaptativo e em cada
+ * representação fixa, comparando tempos e conferindo os resultados
+ */
+void simularCargaAdaptativa() {
+    int operacoesPorFase;
+    printf("=== SIMULAÇÃO DE MUDANÇAS DE CARGA ===\n");
+    printf("Operações por fase (ex: 20000): ");
+    if (scanf("%d", &operacoesPorFase) != 1 || operacoesPorFase <= 0) {
+        limparBuffer();
+        printf("❌ Quantidade inválida!\n");
+        return;
+    }
+    limparBuffer();
+
+    int totalOperacoes = operacoesPorFase * TOTAL_FASES_CARGA;
+    unsigned char* operacoes = (unsigned char*)malloc((size_t)totalOperacoes);
+    int* chaves = (int*)malloc((size_t)totalOperacoes * sizeof(int));
+    Item* modelos = (Item*)malloc(CHAVES_SIMULACAO * sizeof(Item));
+    if (operacoes == NULL || chaves == NULL || modelos == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        free(operacoes);
+        free(chaves);
+        free(modelos);
+        return;
+    }
+
+    for (int k = 0; k < CHAVES_SIMULACAO; k++) {
+        snprintf(modelos[k].nome, TAMANHO_NOME, "Item %04d", k);
+        strcpy(modelos[k].tipo, "teste");
+        modelos[k].quantidade = 1 + k % 10;
+        prepararChavesItem(&modelos[k]);
+    }
+
+    // A mesma sequência vale para todas as estratégias
+    printf("\n📋 FASES (%d operações cada, %d nomes possíveis):\n", operacoesPorFase, CHAVES_SIMULACAO);
+    srand(42);
+    for (int f = 0; f < TOTAL_FASES_CARGA; f++) {
+        const int* p = fasesCarga[f].percentuais;
+        printf("%s %s: %d%% inserções, %d%% remoções, %d%% buscas, %d%% percursos em ordem\n",
+               f == TOTAL_FASES_CARGA - 1 ? "└─" : "├─", fasesCarga[f].nome, p[0], p[1], p[2], p[3]);
+        for (int i = f * operacoesPorFase; i < (f + 1) * operacoesPorFase; i++) {
+            int sorteio = rand() % 100;
+            int op = 0;
+            while (op < TOTAL_OPERACOES - 1 && sorteio >= p[op]) {
+                sorteio -= p[op];
+                op++;
+            }
+            operacoes[i] = (unsigned char)op;
+            chaves[i] = rand() % CHAVES_SIMULACAO;
+        }
+    }
+
+    double tempos[TOTAL_REPRESENTACOES + 1][TOTAL_FASES_CARGA];
+    Representacao finais[TOTAL_FASES_CARGA];
+    int migracoesFase[TOTAL_FASES_CARGA];
+    long long resumos[TOTAL_REPRESENTACOES + 1];
+
+    // Adaptativo, começando como vetor
+    InventarioAdaptativo inv;
+    inicializarAdaptativo(&inv, REPRESENTACAO_VETOR, 1);
+    resumos[TOTAL_REPRESENTACOES] = executarCargaAdaptativa(&inv, operacoes, chaves, operacoesPorFase, modelos,
+                                                            tempos[TOTAL_REPRESENTACOES], finais, migracoesFase);
+
+    printf("\n🔀 INVENTÁRIO ADAPTATIVO:\n");
+    for (int f = 0; f < TOTAL_FASES_CARGA; f++) {
+        printf("├─ %s: %.6f segundos | termina como %s | %d migração(ões)\n", fasesCarga[f].nome,
+               tempos[TOTAL_REPRESENTACOES][f], nomeRepresentacao(finais[f]), migracoesFase[f]);
+    }
+    double custoTotal = inv.custoOperacoes + inv.custoMigracoes;
+    printf("└─ Migrações: %d, custando %.0f (%.1f%% do custo estimado, %.6f segundos)\n", inv.migracoes,
+           inv.custoMigracoes, custoTotal > 0 ? 100.0 * inv.custoMigracoes / custoTotal : 0.0, inv.tempoMigracoes);
+    liberarAdaptativo(&inv);
+
+    // Cada representação fixa
+    for (int r = 0; r < TOTAL_REPRESENTACOES; r++) {
+        inicializarAdaptativo(&inv, REPRESENTACAO_VETOR, 0);
+        migrarAdaptativo(&inv, (Representacao)r);
+        resumos[r] = executarCargaAdaptativa(&inv, operacoes, chaves, operacoesPorFase, modelos,
+                                             tempos[r], finais, migracoesFase);
+        liberarAdaptativo(&inv);
+    }
+
+    printf("\n🏁 TEMPO POR FASE (segundos):\n");
+    int vencedor = TOTAL_REPRESENTACOES;
+    double totais[TOTAL_REPRESENTACOES + 1];
+    for (int e = TOTAL_REPRESENTACOES; e >= 0; e--) {
+        totais[e] = 0.0;
+        printf("%s %-15s:", e == 0 ? "└─" : "├─", e == TOTAL_REPRESENTACOES ? "Adaptativo" :
+               nomeRepresentacao((Representacao)e));
+        for (int f = 0; f < TOTAL_FASES_CARGA; f++) {
+            printf(" %.4f", tempos[e][f]);
+            totais[e] += tempos[e][f];
+        }
+        printf(" | total %.4f\n", totais[e]);
+        if (totais[e] < totais[vencedor]) {
+            vencedor = e;
+        }
+    }
+
+    int consistente = 1;
+    for (int e = 0; e < TOTAL_REPRESENTACOES; e++) {
+        consistente = consistente && resumos[e] == resumos[TOTAL_REPRESENTACOES];
+    }
+    printf("\n🏆 Mais rápido no total: %s\n", vencedor == TOTAL_REPRESENTACOES ? "Adaptativo" :
+           nomeRepresentacao((Representacao)vencedor));
+    printf("%s\n", consistente ? "✅ Todas as estratégias deram os mesmos resultados" :
+           "❌ ERRO: As estratégias deram resultados diferentes!");
+
+    free(operacoes);
+    free(chaves);
+    free(modelos);
+}
+
+
+/*
+ * ========================================
+ * MODO SERVIDOR (SOCKET UNIX + EPOLL)
+ * ========================================
+ *
+ * Protocolo de linhas com campos separados por TAB. Cada requisição recebe
+ * uma resposta, na ordem de chegada, então o cliente pode mandar várias
+ * requisições seguidas sem esperar as respostas (pipelining):
+ *   INSERIR nome tipo quantidade   -> OK | EXISTE | ERRO motivo
+ *                                     (nome e tipo vazios ou longos demais: ERRO formato)
+ *   REMOVER nome                   -> OK | NAO
+ *   BUSCAR nome                    -> ITEM nome tipo quantidade | NAO
+ *   LISTAR                         -> LISTA n, seguida de n linhas nome tipo quantidade
+ *   ORDENAR nome|tipo|quantidade   -> como LISTAR, na ordem do campo pedido
+ *   ESTATISTICAS                   -> EST itens representação operações migrações
+ *   SAIR                           -> fecha a conexão depois das respostas pendentes
+ * Uma só thread atende todas as conexões, então o inventário não precisa de trava
+ */
+
+#define MENOR_TIPO_PONTEIRO(a, b) (strcmp((*(a))->chaveTipo, (*(b))->chaveTipo) < 0)
+#define MENOR_QUANTIDADE_PONTEIRO(a, b) ((*(a))->quantidade < (*(b))->quantidade)
+
+DEFINIR_ORDENACOES(TipoPonteiro, const Item*, MENOR_TIPO_PONTEIRO)
+DEFINIR_ORDENACOES(QuantidadePonteiro, const Item*, MENOR_QUANTIDADE_PONTEIRO)
+
+// Conexão de um cliente do modo servidor
+typedef struct ConexaoServidor {
+    int descritor;
+    unsigned int eventos;        // Interesse registrado no epoll
+    int encerrar;                // SAIR ou erro: fecha assim que a saída esvaziar
+    int fimEntrada;              // O cliente fechou o envio; ainda recebe as respostas
+    char entrada[TAMANHO_LEITURA + MAX_LINHA_PROTOCOLO];
+    size_t tamanhoEntrada;       // Bytes recebidos ainda não processados
+    char* saida;                 // Respostas ainda não enviadas, a partir de inicioSaida
+    size_t inicioSaida;
+    size_t tamanhoSaida;
+    size_t capacidadeSaida;
+    struct ConexaoServidor* anterior;
+    struct ConexaoServidor* proxima;
+} ConexaoServidor;
+
+// Contadores de uma execução do servidor
+typedef struct {
+    long conexoesAceitas;
+    int conexoesAtivas;
+    long long requisicoes;
+    long long bytesRecebidos;
+    long long bytesEnviados;
+    int pausasLeitura;           // Vezes que uma conexão parou de ser lida por excesso de saída
+} EstatisticasServidor;
+
+static volatile sig_atomic_t servidorAtivo = 0;
+static int marcadorTerminal;     // data.ptr do stdin no epoll (o socket de escuta usa NULL)
+static EstatisticasServidor estatisticasServidor;
+static ConexaoServidor* conexoesServidor = NULL;
+
+static void pararServidor(int sinal) {
+    (void)sinal;
+    servidorAtivo = 0;
+}
+
+static size_t saidaPendente(const ConexaoServidor* conexao) {
+    return conexao->tamanhoSaida - conexao->inicioSaida;
+}
+
+static int temLinhaCompleta(const ConexaoServidor* conexao) {
+    return memchr(conexao->entrada, '\n', conexao->tamanhoEntrada) != NULL;
+}
+
+/*
+ * Acrescenta bytes à saída da conexão; retorna 0 se faltou memória
+ */
+static int anexarSaida(ConexaoServidor* conexao, const char* dados, size_t tamanho) {
+    if (conexao->tamanhoSaida + tamanho > conexao->capacidadeSaida && conexao->inicioSaida > 0) {
+        memmove(conexao->saida, conexao->saida + conexao->inicioSaida, saidaPendente(conexao));
+        conexao->tamanhoSaida -= conexao->inicioSaida;
+        conexao->inicioSaida = 0;
+    }
+    if (conexao->tamanhoSaida + tamanho > conexao->capacidadeSaida) {
+        size_t capacidade = conexao->capacidadeSaida > 0 ? conexao->capacidadeSaida * 2 : 4096;
+        while (capacidade < conexao->tamanhoSaida + tamanho) {
+            capacidade *= 2;
+        }
+        char* saida = (char*)realloc(conexao->saida, capacidade);
+        if (saida == NULL) {
+            return 0;
+        }
+        conexao->saida = saida;
+        conexao->capacidadeSaida = capacidade;
+    }
+    memcpy(conexao->saida + conexao->tamanhoSaida, dados, tamanho);
+    conexao->tamanhoSaida += tamanho;
+    return 1;
+}
+
+static void responder(ConexaoServidor* conexao, const char* formato, ...) {
+    char linha[256];
+    va_list argumentos;
+    va_start(argumentos, formato);
+    int tamanho = vsnprintf(linha, sizeof(linha), formato, argumentos);
+    va_end(argumentos);
+
+    if (tamanho >= (int)sizeof(linha)) {
+        tamanho = sizeof(linha) - 1;
+    }
+    if (tamanho > 0 && !anexarSaida(conexao, linha, (size_t)tamanho)) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        conexao->encerrar = 1;
+    }
+}
+
+// Guarda os itens visitados em ordem alfabética para o ORDENAR
+typedef struct {
+    const Item** itens;
+    int total;
+} ColetaServidor;
+
+static void coletarItemServidor(const Item* item, void* contexto) {
+    ColetaServidor* coleta = (ColetaServidor*)contexto;
+    coleta->itens[coleta->total++] = item;
+}
+
+/*
+ * Responde LISTAR e ORDENAR: os itens em ordem alfabética, reordenados de
+ * forma estável pelo campo pedido (empates continuam em ordem de nome)
+ */
+static void responderListagem(ConexaoServidor* conexao, const char* campo) {
+    int total = inventarioAdaptativo.total;
+    ColetaServidor coleta;
+    coleta.itens = (const Item**)malloc((size_t)(total > 0 ? total : 1) * sizeof(const Item*));
+    coleta.total = 0;
+    if (coleta.itens == NULL) {
+        responder(conexao, "ERRO memoria\n");
+        return;
+    }
+    percorrerAdaptativo(&inventarioAdaptativo, coletarItemServidor, &coleta);
+
+    if (strcmp(campo, "tipo") == 0) {
+        ordenarNaturalTipoPonteiro(coleta.itens, coleta.total);
+    } else if (strcmp(campo, "quantidade") == 0) {
+        ordenarNaturalQuantidadePonteiro(coleta.itens, coleta.total);
+    }
+
+    responder(conexao, "LISTA\t%d\n", coleta.total);
+    for (int i = 0; i < coleta.total && !conexao->encerrar; i++) {
+        responder(conexao, "%s\t%s\t%d\n", coleta.itens[i]->nome, coleta.itens[i]->tipo,
+                  coleta.itens[i]->quantidade);
+    }
+    free(coleta.itens);
+}
+
+// Divide a linha nos TABs; retorna quantos campos achou
+static int separarCampos(char* linha, char* campos[], int maximo) {
+    int total = 0;
+    campos[total++] = linha;
+    for (char* c = linha; *c != '\0'; c++) {
+        if (*c == '\t') {
+            *c = '\0';
+            if (total == maximo) {
+                return maximo + 1;  // Campos demais
+            }
+            campos[total++] = c + 1;
+        }
+    }
+    return total;
+}
+
+/*
+ * Executa uma requisição e anexa a resposta na saída da conexão
+ */
+static void processarRequisicao(ConexaoServidor* conexao, char* linha) {
+    char* campos[4];
+    int total = separarCampos(linha, campos, 4);
+    char chave[TAMANHO_NOME];
+
+    estatisticasServidor.requisicoes++;
+
+    if (strcmp(campos[0], "BUSCAR") == 0 && total == 2) {
+        // Nome que não cabe em TAMANHO_NOME nunca foi cadastrado; truncar acharia outro item
+        const Item* item = NULL;
+        if (strlen(campos[1]) < TAMANHO_NOME) {
+            normalizarTexto(campos[1], chave, TAMANHO_NOME);
+            item = buscarAdaptativo(&inventarioAdaptativo, chave);
+        }
+        if (item != NULL) {
+            responder(conexao, "ITEM\t%s\t%s\t%d\n", item->nome, item->tipo, item->quantidade);
+        } else {
+            responder(conexao, "NAO\n");
+        }
+    } else if (strcmp(campos[0], "INSERIR") == 0 && total == 4) {
+        Item item;
+        char* fim;
+        long quantidade = strtol(campos[3], &fim, 10);
+        if (*campos[1] == '\0' || *campos[2] == '\0' || *fim != '\0' || quantidade <= 0 || quantidade > 1000000 ||
+            strlen(campos[1]) >= TAMANHO_NOME || strlen(campos[2]) >= TAMANHO_TIPO) {
+            responder(conexao, "ERRO formato\n");
+            return;
+        }
+        snprintf(item.nome, TAMANHO_NOME, "%s", campos[1]);
+        snprintf(item.tipo, TAMANHO_TIPO, "%s", campos[2]);
+        item.quantidade = (int)quantidade;
+        prepararChavesItem(&item);
+
+        int resultado = inserirAdaptativo(&inventarioAdaptativo, &item);
+        responder(conexao, resultado == 1 ? "OK\n" : (resultado == 0 ? "EXISTE\n" : "ERRO memoria\n"));
+    } else if (strcmp(campos[0], "REMOVER") == 0 && total == 2) {
+        int removido = 0;
+        if (strlen(campos[1]) < TAMANHO_NOME) {
+            normalizarTexto(campos[1], chave, TAMANHO_NOME);
+            removido = removerAdaptativo(&inventarioAdaptativo, chave);
+        }
+        responder(conexao, removido ? "OK\n" : "NAO\n");
+    } else if (strcmp(campos[0], "LISTAR") == 0 && total == 1) {
+        responderListagem(conexao, "nome");
+    } else if (strcmp(campos[0], "ORDENAR") == 0 && total == 2) {
+        if (strcmp(campos[1], "nome") == 0 || strcmp(campos[1], "tipo") == 0 ||
+            strcmp(campos[1], "quantidade") == 0) {
+            responderListagem(conexao, campos[1]);
+        } else {
+            responder(conexao, "ERRO campo\n");
+        }
+    } else if (strcmp(campos[0], "ESTATISTICAS") == 0 && total == 1) {
+        responder(conexao, "EST\t%d\t%s\t%lld\t%d\n", inventarioAdaptativo.total,
+                  nomeRepresentacao(inventarioAdaptativo.representacao),
+                  inventarioAdaptativo.operacoes, inventarioAdaptativo.migracoes);
+    } else if (strcmp(campos[0], "SAIR") == 0 && total == 1) {
+        conexao->encerrar = 1;
+    } else {
+        responder(conexao, "ERRO comando\n");
+    }
+}
+
+/*
+ * Processa as linhas completas já recebidas
+ * Para quando a saída passa de LIMITE_SAIDA; o resto espera o cliente ler
+ */
+static void processarEntrada(ConexaoServidor* conexao) {
+    size_t inicio = 0;
+
+    while (!conexao->encerrar && saidaPendente(conexao) < LIMITE_SAIDA) {
+        char* quebra = (char*)memchr(conexao->entrada + inicio, '\n', conexao->tamanhoEntrada - inicio);
+        if (quebra == NULL) {
+            break;
+        }
+        *quebra = '\0';
+        if (quebra > conexao->entrada + inicio && quebra[-1] == '\r') {
+            quebra[-1] = '\0';
+        }
+        processarRequisicao(conexao, conexao->entrada + inicio);
+        inicio = (size_t)(quebra - conexao->entrada) + 1;
+    }
+
+    memmove(conexao->entrada, conexao->entrada + inicio, conexao->tamanhoEntrada - inicio);
+    conexao->tamanhoEntrada -= inicio;
+
+    if (!conexao->encerrar && conexao->tamanhoEntrada >= MAX_LINHA_PROTOCOLO && !temLinhaCompleta(conexao)) {
+        responder(conexao, "ERRO linha longa\n");
+        conexao->encerrar = 1;
+    }
+}
+
+/*
+ * Envia o que der sem bloquear; retorna 0 se a conexão caiu
+ */
+static int enviarSaida(ConexaoServidor* conexao) {
+    while (saidaPendente(conexao) > 0) {
+        ssize_t enviados = send(conexao->descritor, conexao->saida + conexao->inicioSaida,
+                                saidaPendente(conexao), MSG_NOSIGNAL);
+        if (enviados < 0) {
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        }
+        conexao->inicioSaida += (size_t)enviados;
+        estatisticasServidor.bytesEnviados += enviados;
+    }
+    conexao->inicioSaida = 0;
+    conexao->tamanhoSaida = 0;
+    return 1;
+}
+
+/*
+ * Lê enquanto a saída estiver abaixo do limite e escreve enquanto houver saída
+ */
+static void atualizarInteresse(int epoll, ConexaoServidor* conexao) {
+    unsigned int eventos = 0;
+    if (!conexao->encerrar && !conexao->fimEntrada && saidaPendente(conexao) < LIMITE_SAIDA) {
+        eventos |= EPOLLIN;
+    }
+    if (saidaPendente(conexao) > 0) {
+        eventos |= EPOLLOUT;
+    }
+    if (eventos != conexao->eventos) {
+        if ((conexao->eventos & EPOLLIN) && !(eventos & EPOLLIN) && !conexao->encerrar && !conexao->fimEntrada) {
+            estatisticasServidor.pausasLeitura++;
+        }
+        struct epoll_event evento = {.events = eventos, .data.ptr = conexao};
+        epoll_ctl(epoll, EPOLL_CTL_MOD, conexao->descritor, &evento);
+        conexao->eventos = eventos;
+    }
+}
+
+static void fecharConexao(int epoll, ConexaoServidor* conexao) {
+    epoll_ctl(epoll, EPOLL_CTL_DEL, conexao->descritor, NULL);
+    close(conexao->descritor);
+    if (conexao->anterior != NULL) {
+        conexao->anterior->proxima = conexao->proxima;
+    } else {
+        conexoesServidor = conexao->proxima;
+    }
+    if (conexao->proxima != NULL) {
+        conexao->proxima->anterior = conexao->anterior;
+    }
+    free(conexao->saida);
+    free(conexao);
+    estatisticasServidor.conexoesAtivas--;
+}
+
+// Aceita todas as conexões pendentes no socket de escuta
+static void aceitarConexoes(int epoll, int escuta) {
+    for (;;) {
+        int descritor = accept4(escuta, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (descritor < 0) {
+            return;  // EAGAIN: não há mais ninguém esperando
+        }
+        ConexaoServidor* conexao = (ConexaoServidor*)malloc(sizeof(ConexaoServidor));
+        if (conexao == NULL) {
+            printf("❌ ERRO: Falha na alocação de memória!\n");
+            close(descritor);
+            continue;
+        }
+        conexao->descritor = descritor;
+        conexao->eventos = EPOLLIN;
+        conexao->encerrar = 0;
+        conexao->fimEntrada = 0;
+        conexao->tamanhoEntrada = 0;
+        conexao->saida = NULL;
+        conexao->inicioSaida = 0;
+        conexao->tamanhoSaida = 0;
+        conexao->capacidadeSaida = 0;
+
+        struct epoll_event evento = {.events = EPOLLIN, .data.ptr = conexao};
+        if (epoll_ctl(epoll, EPOLL_CTL_ADD, descritor, &evento) < 0) {
+            close(descritor);
+            free(conexao);
+            continue;
+        }
+        conexao->anterior = NULL;
+        conexao->proxima = conexoesServidor;
+        if (conexoesServidor != NULL) {
+            conexoesServidor->anterior = conexao;
+        }
+        conexoesServidor = conexao;
+        estatisticasServidor.conexoesAceitas++;
+        estatisticasServidor.conexoesAtivas++;
+    }
+}
+
+/*
+ * Trata os eventos de uma conexão: lê um bloco, responde as linhas completas
+ * e já tenta enviar, sem esperar outra volta do epoll
+ */
+static void atenderConexao(int epoll, ConexaoServidor* conexao, unsigned int eventos) {
+    if (eventos & EPOLLERR) {
+        fecharConexao(epoll, conexao);
+        return;
+    }
+    if ((eventos & (EPOLLIN | EPOLLHUP)) && !conexao->encerrar && !conexao->fimEntrada) {
+        ssize_t lidos = recv(conexao->descritor, conexao->entrada + conexao->tamanhoEntrada,
+                             sizeof(conexao->entrada) - conexao->tamanhoEntrada, 0);
+        if (lidos > 0) {
+            conexao->tamanhoEntrada += (size_t)lidos;
+            estatisticasServidor.bytesRecebidos += lidos;
+        } else if (lidos == 0) {
+            conexao->fimEntrada = 1;
+        } else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+            fecharConexao(epoll, conexao);
+            return;
+        }
+    }
+
+    // Se a saída esvaziar com linhas ainda na fila (paradas pelo LIMITE_SAIDA), continua
+    do {
+        processarEntrada(conexao);
+        if (!enviarSaida(conexao)) {
+            fecharConexao(epoll, conexao);
+            return;
+        }
+    } while (saidaPendente(conexao) == 0 && !conexao->encerrar && temLinhaCompleta(conexao));
+
+    if (saidaPendente(conexao) == 0 && (conexao->encerrar || conexao->fimEntrada)) {
+        fecharConexao(epoll, conexao);
+    } else {
+        atualizarInteresse(epoll, conexao);
+    }
+}
+
+/*
+ * Atende clientes no socket Unix até Enter no terminal, SIGINT ou SIGTERM
+ * Serve o inventário adaptativo, que continua escolhendo a representação
+ * pela carga que chega dos clientes
+ */
+void executarServidor(const char* caminho) {
+    struct sockaddr_un endereco;
+    if (strlen(caminho) >= sizeof(endereco.sun_path)) {
+        printf("❌ ERRO: Caminho do socket muito longo!\n");
+        return;
+    }
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    strcpy(endereco.sun_path, caminho);
+
+    // Um socket esquecido por uma execução anterior impediria o bind
+    struct stat informacoes;
+    if (lstat(caminho, &informacoes) == 0 && S_ISSOCK(informacoes.st_mode)) {
+        unlink(caminho);
+    }
+
+    int escuta = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (escuta < 0 || bind(escuta, (struct sockaddr*)&endereco, sizeof(endereco)) < 0 ||
+        listen(escuta, SOMAXCONN) < 0) {
+        printf("❌ ERRO: Não foi possível escutar em %s: %s\n", caminho, strerror(errno));
+        if (escuta >= 0) {
+            close(escuta);
+        }
+        return;
+    }
+
+    int epoll = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll < 0) {
+        printf("❌ ERRO: epoll_create1: %s\n", strerror(errno));
+        close(escuta);
+        unlink(caminho);
+        return;
+    }
+    struct epoll_event evento = {.events = EPOLLIN, .data.ptr = NULL};
+    epoll_ctl(epoll, EPOLL_CTL_ADD, escuta, &evento);
+    evento.data.ptr = &marcadorTerminal;
+    int terminal = epoll_ctl(epoll, EPOLL_CTL_ADD, STDIN_FILENO, &evento) == 0; // Falha se stdin for arquivo
+
+    // Sem SA_RESTART: o sinal interrompe o epoll_wait e o laço confere servidorAtivo
+    struct sigaction acao, acaoInt, acaoTerm;
+    memset(&acao, 0, sizeof(acao));
+    acao.sa_handler = pararServidor;
+    sigemptyset(&acao.sa_mask);
+    sigaction(SIGINT, &acao, &acaoInt);
+    sigaction(SIGTERM, &acao, &acaoTerm);
+
+    memset(&estatisticasServidor, 0, sizeof(estatisticasServidor));
+    long long operacoesAntes = inventarioAdaptativo.operacoes;
+    int migracoesAntes = inventarioAdaptativo.migracoes;
+
+    printf("=== MODO SERVIDOR ===\n");
+    printf("🔌 Escutando em %s (protocolo de linhas, campos separados por TAB)\n", caminho);
+    printf("Comandos: INSERIR, REMOVER, BUSCAR, LISTAR, ORDENAR, ESTATISTICAS, SAIR\n");
+    printf("%s\n", terminal ? "Pressione Enter para encerrar o servidor." : "Envie SIGINT ou SIGTERM para encerrar.");
+    fflush(stdout);
+
+    struct timespec inicio, fim;
+    clock_gettime(CLOCK_MONOTONIC, &inicio);
+    struct epoll_event eventos[MAX_EVENTOS];
+    servidorAtivo = 1;
+
+    while (servidorAtivo) {
+        int prontos = epoll_wait(epoll, eventos, MAX_EVENTOS, -1);
+        if (prontos < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            printf("❌ ERRO: epoll_wait: %s\n", strerror(errno));
+            break;
+        }
+        for (int i = 0; i < prontos; i++) {
+            void* dono = eventos[i].data.ptr;
+            if (dono == NULL) {
+                aceitarConexoes(epoll, escuta);
+            } else if (dono == &marcadorTerminal) {
+                char linha[64];
+                if (fgets(linha, sizeof(linha), stdin) != NULL) {
+                    servidorAtivo = 0;
+                } else {
+                    epoll_ctl(epoll, EPOLL_CTL_DEL, STDIN_FILENO, NULL); // stdin acabou: só os sinais param
+                    clearerr(stdin);
+                }
+            } else {
+                atenderConexao(epoll, (ConexaoServidor*)dono, eventos[i].events);
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &fim);
+
+    while (conexoesServidor != NULL) {
+        fecharConexao(epoll, conexoesServidor);
+    }
+    close(epoll);
+    close(escuta);
+    unlink(caminho);
+    sigaction(SIGINT, &acaoInt, NULL);
+    sigaction(SIGTERM, &acaoTerm, NULL);
+
+    double segundos = (fim.tv_sec - inicio.tv_sec) + (fim.tv_nsec - inicio.tv_nsec) / 1e9;
+    printf("\n📊 SERVIDOR ENCERRADO após %.2f segundos:\n", segundos);
+    printf("├─ Conexões atendidas: %ld\n", estatisticasServidor.conexoesAceitas);
+    printf("├─ Requisições: %lld (%.0f por segundo)\n", estatisticasServidor.requisicoes,
+           segundos > 0 ? estatisticasServidor.requisicoes / segundos : 0.0);
+    printf("├─ Recebidos: %.1f KB | Enviados: %.1f KB\n", estatisticasServidor.bytesRecebidos / 1024.0,
+           estatisticasServidor.bytesEnviados / 1024.0);
+    printf("├─ Pausas de leitura por saída acumulada: %d\n", estatisticasServidor.pausasLeitura);
+    printf("├─ Operações no inventário: %lld | Migrações: %d\n",
+           inventarioAdaptativo.operacoes - operacoesAntes, inventarioAdaptativo.migracoes - migracoesAntes);
+    printf("└─ Inventário: %d itens em %s\n", inventarioAdaptativo.total,
+           nomeRepresentacao(inventarioAdaptativo.representacao));
+}
+
+/*
+ * Pergunta o caminho do socket e roda o servidor
+ */
+void iniciarServidorMenu() {
+    char caminho[108];
+    printf("Caminho do socket (vazio para %s): ", CAMINHO_SOCKET_PADRAO);
+    if (fgets(caminho, sizeof(caminho), stdin) == NULL) {
+        return;
+    }
+    caminho[strcspn(caminho, "\n")] = '\0';
+    executarServidor(caminho[0] != '\0' ? caminho : CAMINHO_SOCKET_PADRAO);
+}
+
+
+/*
+ * ========================================
+ * FILTRO DE BLOOM
+ * ========================================
+ */
+
+/*
+ * Refazem o filtro com os nomes presentes, mantendo as estatísticas de consultas
+ */
+void reconstruirBloomVetor() {
+    reiniciarBitsBloom(&filtroVetor);
+    for (int i = 0; i < totalItensVetor; i++) {
+        adicionarBloom(&filtroVetor, inventarioVetor[i].chaveNome);
+    }
+}
+
+void reconstruirBloomLista() {
+    reiniciarBitsBloom(&filtroLista);
+    for (No* atual = inicioLista; atual != NULL; atual = atual->proximo) {
+        adicionarBloom(&filtroLista, atual->dados.chaveNome);
+    }
+}
+
+/*
+ * Exibe ocupação e taxa de falsos positivos observada do filtro
+ */
+void exibirEstatisticasBloom(const char* estrutura, const FiltroBloom* filtro) {
+    printf("Filtro de Bloom (%s): %d/%d bits | %d consultas, %d descartadas | "
+           "falsos positivos: %d (%.2f%%)\n",
+           estrutura, bitsLigadosBloom(filtro), BLOOM_BLOCOS * 512, filtro->consultas, filtro->rejeitadas,
+           filtro->falsosPositivos, taxaFalsosPositivosBloom(filtro));
+}
@@ -0,0 +1,370 @@
+/*
+ * Gerador de Carga para o Modo Servidor do Inventário
+ *
+ * Abre várias conexões com o servidor do aventureiro (./aventureiro --servidor)
+ * e, em cada uma, mantém até "profundidade" requisições em voo (pipelining):
+ * novas requisições saem sem esperar as respostas das anteriores. Ao final
+ * informa a vazão total e os percentis da latência de cada requisição, do
+ * momento em que foi gerada até a chegada da resposta.
+ *
+ * Uso: ./carga [-s socket] [-c conexões] [-n requisições por conexão]
+ *              [-p profundidade] [-k nomes distintos]
+ *
+ * O mix imita um inventário em uso: buscas em maioria, cadastros e remoções
+ * sobre o mesmo conjunto de nomes e, raramente, listagens completas.
+ */
+
+#define _GNU_SOURCE  // MSG_NOSIGNAL e rand_r
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "ordenacao.h"
+
+// Constantes do gerador
+#define CAMINHO_SOCKET_PADRAO "/tmp/inventario.sock"
+#define MAX_CONEXOES 256
+#define TAMANHO_ENVIO 65536       // Requisições geradas e ainda não enviadas
+#define TAMANHO_RECEPCAO 65536    // Respostas recebidas e ainda não interpretadas
+#define MAX_REQUISICAO 128        // Maior requisição gerada, em bytes
+#define PERCENTUAL_INSERIR 20
+#define PERCENTUAL_REMOVER 10
+#define PERCENTUAL_LISTAR 1       // Metade LISTAR, metade ORDENAR quantidade; o resto é BUSCAR
+
+// Respostas do protocolo, pela primeira palavra da linha
+typedef enum {
+    RESPOSTA_OK,
+    RESPOSTA_EXISTE,
+    RESPOSTA_NAO,
+    RESPOSTA_ITEM,
+    RESPOSTA_LISTA,
+    RESPOSTA_EST,
+    RESPOSTA_ERRO,
+    TOTAL_RESPOSTAS
+} TipoResposta;
+
+// Uma conexão do gerador, executada em sua própria thread
+typedef struct {
+    const char* caminho;
+    int requisicoes;
+    int profundidade;
+    int chaves;
+    unsigned int semente;
+    double* latencias;            // Segundos, uma por requisição respondida
+    int respondidas;
+    long respostas[TOTAL_RESPOSTAS];
+    const char* falha;            // NULL se a conexão terminou normalmente
+} ClienteCarga;
+
+#define MENOR_LATENCIA(a, b) (*(a) < *(b))
+
+DEFINIR_ORDENACOES(Latencia, double, MENOR_LATENCIA)
+
+// Declaração das funções
+void* executarCliente(void* arg);
+int gerarRequisicao(ClienteCarga* cliente, char* destino);
+TipoResposta classificarResposta(const char* linha);
+double percentil(const double latencias[], long total, double fracao);
+double relogio();
+
+/*
+ * Função principal do programa
+ */
+int main(int argc, char* argv[]) {
+    const char* caminho = CAMINHO_SOCKET_PADRAO;
+    int conexoes = 8;
+    int requisicoes = 20000;
+    int profundidade = 16;
+    int chaves = 4096;
+    int opcao;
+
+    while ((opcao = getopt(argc, argv, "s:c:n:p:k:h")) != -1) {
+        switch (opcao) {
+            case 's': caminho = optarg; break;
+            case 'c': conexoes = atoi(optarg); break;
+            case 'n': requisicoes = atoi(optarg); break;
+            case 'p': profundidade = atoi(optarg); break;
+            case 'k': chaves = atoi(optarg); break;
+            default:
+                printf("Uso: %s [-s socket] [-c conexões] [-n requisições por conexão] "
+                       "[-p profundidade] [-k nomes distintos]\n", argv[0]);
+                return opcao == 'h' ? 0 : 1;
+        }
+    }
+    if (conexoes < 1 || conexoes > MAX_CONEXOES || requisicoes < 1 || profundidade < 1 || chaves < 1) {
+        printf("❌ Parâmetros inválidos! (conexões de 1 a %d, demais valores positivos)\n", MAX_CONEXOES);
+        return 1;
+    }
+    // O buffer de envio precisa caber uma janela inteira
+    if (profundidade > TAMANHO_ENVIO / MAX_REQUISICAO) {
+        profundidade = TAMANHO_ENVIO / MAX_REQUISICAO;
+    }
+
+    printf("=== GERADOR DE CARGA ===\n");
+    printf("Servidor: %s\n", caminho);
+    printf("Conexões: %d | Requisições por conexão: %d | Profundidade: %d | Nomes: %d\n",
+           conexoes, requisicoes, profundidade, chaves);
+    printf("Mix: %d%% inserções, %d%% remoções, %d%% listagens, %d%% buscas\n\n",
+           PERCENTUAL_INSERIR, PERCENTUAL_REMOVER, PERCENTUAL_LISTAR,
+           100 - PERCENTUAL_INSERIR - PERCENTUAL_REMOVER - PERCENTUAL_LISTAR);
+
+    ClienteCarga clientes[MAX_CONEXOES];
+    pthread_t threads[MAX_CONEXOES];
+    int criada[MAX_CONEXOES];
+
+    for (int i = 0; i < conexoes; i++) {
+        memset(&clientes[i], 0, sizeof(ClienteCarga));
+        clientes[i].caminho = caminho;
+        clientes[i].requisicoes = requisicoes;
+        clientes[i].profundidade = profundidade;
+        clientes[i].chaves = chaves;
+        clientes[i].semente = (unsigned int)(i + 1) * 7919u;
+        clientes[i].latencias = (double*)malloc((size_t)requisicoes * sizeof(double));
+        if (clientes[i].latencias == NULL) {
+            printf("❌ ERRO: Falha na alocação de memória!\n");
+            return 1;
+        }
+    }
+
+    printf("🔄 Enviando %ld requisições...\n", (long)conexoes * requisicoes);
+    double inicio = relogio();
+    for (int i = 0; i < conexoes; i++) {
+        criada[i] = pthread_create(&threads[i], NULL, executarCliente, &clientes[i]) == 0;
+        if (!criada[i]) {
+            executarCliente(&clientes[i]); // Sem thread disponível: roda aqui mesmo
+        }
+    }
+    for (int i = 0; i < conexoes; i++) {
+        if (criada[i]) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+    double tempo = relogio() - inicio;
+
+    // Junta as latências e as contagens de todas as conexões
+    long total = 0;
+    long respostas[TOTAL_RESPOSTAS] = {0};
+    int falhas = 0;
+    for (int i = 0; i < conexoes; i++) {
+        total += clientes[i].respondidas;
+        for (int r = 0; r < TOTAL_RESPOSTAS; r++) {
+            respostas[r] += clientes[i].respostas[r];
+        }
+        if (clientes[i].falha != NULL) {
+            printf("❌ Conexão %d: %s\n", i + 1, clientes[i].falha);
+            falhas++;
+        }
+    }
+
+    double* latencias = (double*)malloc((size_t)(total > 0 ? total : 1) * sizeof(double));
+    if (latencias == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return 1;
+    }
+    long posicao = 0;
+    for (int i = 0; i < conexoes; i++) {
+        memcpy(latencias + posicao, clientes[i].latencias, (size_t)clientes[i].respondidas * sizeof(double));
+        posicao += clientes[i].respondidas;
+        free(clientes[i].latencias);
+    }
+    ordenarQuickLatencia(latencias, (int)total);
+
+    printf("\n📊 RESULTADO:\n");
+    printf("├─ Respondidas: %ld em %.3f segundos\n", total, tempo);
+    printf("├─ Vazão: %.0f requisições por segundo\n", tempo > 0 ? total / tempo : 0.0);
+    printf("├─ Respostas: OK %ld | EXISTE %ld | NAO %ld | ITEM %ld | LISTA %ld | ERRO %ld\n",
+           respostas[RESPOSTA_OK], respostas[RESPOSTA_EXISTE], respostas[RESPOSTA_NAO],
+           respostas[RESPOSTA_ITEM], respostas[RESPOSTA_LISTA], respostas[RESPOSTA_ERRO]);
+    printf("└─ Latência (µs): p50 %.1f | p90 %.1f | p99 %.1f | p99.9 %.1f | máx %.1f\n",
+           percentil(latencias, total, 0.50) * 1e6, percentil(latencias, total, 0.90) * 1e6,
+           percentil(latencias, total, 0.99) * 1e6, percentil(latencias, total, 0.999) * 1e6,
+           total > 0 ? latencias[total - 1] * 1e6 : 0.0);
+    if (falhas > 0) {
+        printf("⚠️  %d conexão(ões) terminaram antes do fim\n", falhas);
+    }
+
+    free(latencias);
+    return falhas > 0;
+}
+
+/*
+ * Relógio monotônico em segundos
+ */
+double relogio() {
+    struct timespec agora;
+    clock_gettime(CLOCK_MONOTONIC, &agora);
+    return agora.tv_sec + agora.tv_nsec / 1e9;
+}
+
+/*
+ * Percentil pelo posto mais próximo, sobre latências já ordenadas
+ */
+double percentil(const double latencias[], long total, double fracao) {
+    if (total == 0) {
+        return 0.0;
+    }
+    long indice = (long)(fracao * total);
+    return latencias[indice < total ? indice : total - 1];
+}
+
+/*
+ * Escreve a próxima requisição do mix em destino; retorna o tamanho
+ */
+int gerarRequisicao(ClienteCarga* cliente, char* destino) {
+    int sorteio = rand_r(&cliente->semente) % 100;
+    int chave = rand_r(&cliente->semente) % cliente->chaves;
+
+    if (sorteio < PERCENTUAL_INSERIR) {
+        return snprintf(destino, MAX_REQUISICAO, "INSERIR\titem-%05d\tcarga\t%d\n", chave, 1 + chave % 50);
+    }
+    sorteio -= PERCENTUAL_INSERIR;
+    if (sorteio < PERCENTUAL_REMOVER) {
+        return snprintf(destino, MAX_REQUISICAO, "REMOVER\titem-%05d\n", chave);
+    }
+    sorteio -= PERCENTUAL_REMOVER;
+    if (sorteio < PERCENTUAL_LISTAR) {
+        return snprintf(destino, MAX_REQUISICAO, chave % 2 ? "LISTAR\n" : "ORDENAR\tquantidade\n");
+    }
+    return snprintf(destino, MAX_REQUISICAO, "BUSCAR\titem-%05d\n", chave);
+}
+
+TipoResposta classificarResposta(const char* linha) {
+    const char* nomes[TOTAL_RESPOSTAS] = {"OK", "EXISTE", "NAO", "ITEM", "LISTA", "EST", "ERRO"};
+    for (int r = 0; r < TOTAL_RESPOSTAS; r++) {
+        size_t tamanho = strlen(nomes[r]);
+        if (strncmp(linha, nomes[r], tamanho) == 0 && (linha[tamanho] == '\0' || linha[tamanho] == '\t')) {
+            return (TipoResposta)r;
+        }
+    }
+    return RESPOSTA_ERRO;
+}
+
+/*
+ * Laço de uma conexão: completa a janela de requisições em voo, envia e lê
+ * sem bloquear (poll), e casa cada resposta com a requisição mais antiga
+ * Respostas LISTA ocupam a linha de cabeçalho mais uma linha por item
+ * Retorna NULL ou a descrição da falha
+ */
+static const char* conversarServidor(ClienteCarga* cliente, int descritor, double envios[],
+                                     char envio[], char recepcao[]) {
+    int enviadas = 0;
+    size_t inicioEnvio = 0, tamanhoEnvio = 0;
+    size_t tamanhoRecepcao = 0;
+    long linhasLista = 0;  // Linhas de itens que ainda faltam na resposta LISTA atual
+
+    while (cliente->respondidas < cliente->requisicoes) {
+        // Completa a janela de requisições em voo
+        if (inicioEnvio > 0) {
+            memmove(envio, envio + inicioEnvio, tamanhoEnvio - inicioEnvio);
+            tamanhoEnvio -= inicioEnvio;
+            inicioEnvio = 0;
+        }
+        while (enviadas < cliente->requisicoes &&
+               enviadas - cliente->respondidas < cliente->profundidade &&
+               TAMANHO_ENVIO - tamanhoEnvio >= MAX_REQUISICAO) {
+            tamanhoEnvio += (size_t)gerarRequisicao(cliente, envio + tamanhoEnvio);
+            envios[enviadas++] = relogio();
+        }
+
+        struct pollfd espera = {descritor, POLLIN | (tamanhoEnvio > inicioEnvio ? POLLOUT : 0), 0};
+        if (poll(&espera, 1, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return "poll falhou";
+        }
+
+        if (espera.revents & POLLOUT) {
+            ssize_t escritos = send(descritor, envio + inicioEnvio, tamanhoEnvio - inicioEnvio, MSG_NOSIGNAL);
+            if (escritos > 0) {
+                inicioEnvio += (size_t)escritos;
+            } else if (escritos < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+                return "o servidor fechou a conexão";
+            }
+        }
+
+        if (espera.revents & (POLLIN | POLLHUP | POLLERR)) {
+            ssize_t lidos = recv(descritor, recepcao + tamanhoRecepcao, TAMANHO_RECEPCAO - tamanhoRecepcao, 0);
+            if (lidos == 0 || (lidos < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+                return "o servidor fechou a conexão";
+            }
+            if (lidos > 0) {
+                tamanhoRecepcao += (size_t)lidos;
+            }
+
+            // Cada linha completa fecha uma resposta, exceto dentro de uma LISTA
+            size_t inicio = 0;
+            char* quebra;
+            while ((quebra = (char*)memchr(recepcao + inicio, '\n', tamanhoRecepcao - inicio)) != NULL) {
+                *quebra = '\0';
+                const char* linha = recepcao + inicio;
+                inicio = (size_t)(quebra - recepcao) + 1;
+
+                if (linhasLista > 0) {
+                    if (--linhasLista > 0) {
+                        continue;
+                    }
+                } else {
+                    TipoResposta resposta = classificarResposta(linha);
+                    cliente->respostas[resposta]++;
+                    if (resposta == RESPOSTA_LISTA) {
+                        linhasLista = atol(linha + strlen("LISTA"));
+                        if (linhasLista > 0) {
+                            continue;
+                        }
+                    }
+                }
+                cliente->latencias[cliente->respondidas] = relogio() - envios[cliente->respondidas];
+                cliente->respondidas++;
+            }
+            memmove(recepcao, recepcao + inicio, tamanhoRecepcao - inicio);
+            tamanhoRecepcao -= inicio;
+            if (tamanhoRecepcao == TAMANHO_RECEPCAO) {
+                return "resposta sem fim de linha";
+            }
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Thread de uma conexão: conecta, conversa até a última resposta e libera tudo
+ */
+void* executarCliente(void* arg) {
+    ClienteCarga* cliente = (ClienteCarga*)arg;
+    double* envios = (double*)malloc((size_t)cliente->requisicoes * sizeof(double));
+    char* envio = (char*)malloc(TAMANHO_ENVIO);
+    char* recepcao = (char*)malloc(TAMANHO_RECEPCAO);
+    int descritor = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    struct sockaddr_un endereco;
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    snprintf(endereco.sun_path, sizeof(endereco.sun_path), "%s", cliente->caminho);
+
+    if (envios == NULL || envio == NULL || recepcao == NULL || descritor < 0) {
+        cliente->falha = "sem memória ou sem socket";
+    } else if (connect(descritor, (struct sockaddr*)&endereco, sizeof(endereco)) < 0) {
+        cliente->falha = "não conectou (o servidor está rodando?)";
+    } else {
+        fcntl(descritor, F_SETFL, fcntl(descritor, F_GETFL) | O_NONBLOCK);
+        cliente->falha = conversarServidor(cliente, descritor, envios, envio, recepcao);
+    }
+
+    if (descritor >= 0) {
+        close(descritor);
+    }
+    free(envios);
+    free(envio);
+    free(recepcao);
+    return NULL;
+}
@@ -0,0 +1,44 @@
+/*
+ * Chaves de Colação - implementação (veja colacao.h)
+ */
+
+#include <stddef.h>
+
+#include "colacao.h"
+
+// Letra base de U+00C0 + i, para o segundo byte 0x80 + i de "\xC3.."
+// 0 marca os símbolos que ficam como estão (× ÷ Þ þ); Æ, æ e ß viram duas letras
+static const char letrasLatin1[64] = {
+    'a', 'a', 'a', 'a', 'a', 'a', 0,   'c', 'e', 'e', 'e', 'e', 'i', 'i', 'i', 'i',
+    'd', 'n', 'o', 'o', 'o', 'o', 'o', 0,   'o', 'u', 'u', 'u', 'u', 'y', 0,   0,
+    'a', 'a', 'a', 'a', 'a', 'a', 0,   'c', 'e', 'e', 'e', 'e', 'i', 'i', 'i', 'i',
+    'd', 'n', 'o', 'o', 'o', 'o', 'o', 0,   'o', 'u', 'u', 'u', 'u', 'y', 0,   'y'
+};
+
+void normalizarTexto(const char* texto, char* chave, int tamanho) {
+    const unsigned char* p = (const unsigned char*)texto;
+    int j = 0;
+    while (*p != '\0' && j < tamanho - 1) {
+        if (*p < 0x80) {
+            chave[j++] = (*p >= 'A' && *p <= 'Z') ? (char)(*p + ('a' - 'A')) : (char)*p;
+            p++;
+            continue;
+        }
+        if (*p == 0xC3 && p[1] >= 0x80 && p[1] <= 0xBF) {
+            int i = p[1] - 0x80;
+            const char* dupla = (i == 0x06 || i == 0x26) ? "ae" : (i == 0x1F ? "ss" : NULL);
+            if (letrasLatin1[i] != 0) {
+                chave[j++] = letrasLatin1[i];
+            } else if (j + 2 < tamanho) {
+                chave[j++] = dupla != NULL ? dupla[0] : (char)p[0];
+                chave[j++] = dupla != NULL ? dupla[1] : (char)p[1];
+            } else {
+                break; // Não cabe inteiro: não corta o caractere ao meio
+            }
+            p += 2;
+            continue;
+        }
+        chave[j++] = (char)*p++;
+    }
+    chave[j] = '\0';
+}
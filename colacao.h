@@ -0,0 +1,22 @@
+/*
+ * Chaves de Colação
+ *
+ * Converte um texto UTF-8 em uma chave normalizada para ordenar e buscar:
+ * minúsculas e sem acentos ("Kit Médico" -> "kit medico", "PROPULSÃO" -> "propulsao").
+ * A chave é calculada uma vez, quando o registro é criado, e guardada junto
+ * dele; depois disso comparar dois registros é um strcmp comum sobre as chaves.
+ *
+ * Cobre ASCII e as letras Latin-1 (U+00C0 a U+00FF), que incluem todos os
+ * acentos do português. Outros caracteres multibyte são copiados sem mudança.
+ * A chave nunca é maior que o texto, então cabe num buffer do mesmo tamanho.
+ */
+
+#ifndef COLACAO_H
+#define COLACAO_H
+
+/*
+ * Escreve em chave (com tamanho bytes) a forma normalizada do texto
+ */
+void normalizarTexto(const char* texto, char* chave, int tamanho);
+
+#endif
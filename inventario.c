@@ -0,0 +1,191 @@
+/*
+ * Motor de Inventário - implementação (veja inventario.h)
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "inventario.h"
+#include "colacao.h"
+#include "metricas.h"
+
+void limparBuffer() {
+    int c;
+    while ((c = getchar()) != '\n' && c != EOF);
+}
+
+int lerTexto(char texto[], int tamanho) {
+    if (fgets(texto, tamanho, stdin) == NULL) {
+        texto[0] = '\0';
+        return 1;
+    }
+    size_t fim = strcspn(texto, "\n");
+    if (texto[fim] == '\n') {
+        texto[fim] = '\0';
+        return 1;
+    }
+    
+    // Buffer cheio sem quebra: cabe só se a linha acabava exatamente aqui
+    int c = getchar();
+    if (c == '\n' || c == EOF) {
+        return 1;
+    }
+    limparBuffer();
+    return 0;
+}
+
+void prepararChavesItem(Item* item) {
+    normalizarTexto(item->nome, item->chaveNome, TAMANHO_NOME);
+    normalizarTexto(item->tipo, item->chaveTipo, TAMANHO_TIPO);
+}
+
+// Colunas ocupadas por um texto UTF-8 (bytes de continuação não contam)
+static int larguraTexto(const char* texto) {
+    int largura = 0;
+    for (; *texto; texto++) {
+        if (((unsigned char)*texto & 0xC0) != 0x80) {
+            largura++;
+        }
+    }
+    return largura;
+}
+
+void imprimirCabecalhoTabela(const char* rotuloOrdem, const char* rotuloValor) {
+    // O printf preenche contando bytes, e "Nº" tem 3 bytes em 2 colunas
+    int folgaOrdem = 3 - larguraTexto(rotuloOrdem);
+    int folgaValor = 10 - larguraTexto(rotuloValor);
+
+    printf("┌─────┬──────────────────────────────┬────────────────────┬────────────┐\n");
+    printf("│ %s%*s │ Nome                         │ Tipo               │ %s%*s │\n",
+           rotuloOrdem, folgaOrdem > 0 ? folgaOrdem : 0, "",
+           rotuloValor, folgaValor > 0 ? folgaValor : 0, "");
+    printf("├─────┼──────────────────────────────┼────────────────────┼────────────┤\n");
+}
+
+void imprimirLinhaTabela(int ordem, const char* nome, const char* tipo, int valor) {
+    // Compensa os bytes extras dos acentos para a borda não sair do lugar
+    int larguraNome = 28 + (int)strlen(nome) - larguraTexto(nome);
+    int larguraTipo = 18 + (int)strlen(tipo) - larguraTexto(tipo);
+    printf("│ %-3d │ %-*s │ %-*s │ %-10d │\n", ordem, larguraNome, nome, larguraTipo, tipo, valor);
+}
+
+void imprimirRodapeTabela() {
+    printf("└─────┴──────────────────────────────┴────────────────────┴────────────┘\n");
+}
+
+unsigned long long hashNome(const char* nome) {
+    unsigned long long hash = 1469598103934665603ULL;
+    while (*nome) {
+        hash ^= (unsigned char)*nome++;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+void inicializarBloom(FiltroBloom* filtro) {
+    memset(filtro, 0, sizeof(FiltroBloom));
+}
+
+void reiniciarBitsBloom(FiltroBloom* filtro) {
+    memset(filtro->blocos, 0, sizeof(filtro->blocos));
+    filtro->elementos = 0;
+    filtro->removidos = 0;
+}
+
+/*
+ * Liga os bits do nome no seu bloco
+ */
+void adicionarBloom(FiltroBloom* filtro, const char* nome) {
+    unsigned long long hash = hashNome(nome);
+    unsigned long long* bloco = filtro->blocos[(hash >> 40) % BLOOM_BLOCOS];
+
+    for (int i = 0; i < BLOOM_FUNCOES; i++) {
+        int bit = (hash >> (9 * i)) & 511;
+        bloco[bit >> 6] |= 1ULL << (bit & 63);
+    }
+    filtro->elementos++;
+}
+
+/*
+ * Lê um único bloco de 64 bytes
+ */
+int consultarBloom(FiltroBloom* filtro, const char* nome) {
+    unsigned long long hash = hashNome(nome);
+    const unsigned long long* bloco = filtro->blocos[(hash >> 40) % BLOOM_BLOCOS];
+
+    filtro->consultas++;
+    for (int i = 0; i < BLOOM_FUNCOES; i++) {
+        int bit = (hash >> (9 * i)) & 511;
+        if (!(bloco[bit >> 6] & (1ULL << (bit & 63)))) {
+            filtro->rejeitadas++;
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void registrarResultadoBloom(FiltroBloom* filtro, int encontrado) {
+    if (!encontrado) {
+        filtro->falsosPositivos++;
+    }
+}
+
+int registrarRemocaoBloom(FiltroBloom* filtro) {
+    filtro->removidos++;
+    return filtro->removidos * 4 >= filtro->elementos;
+}
+
+int bitsLigadosBloom(const FiltroBloom* filtro) {
+    int bitsLigados = 0;
+    for (int b = 0; b < BLOOM_BLOCOS; b++) {
+        for (int p = 0; p < 8; p++) {
+            bitsLigados += __builtin_popcountll(filtro->blocos[b][p]);
+        }
+    }
+    return bitsLigados;
+}
+
+double taxaFalsosPositivosBloom(const FiltroBloom* filtro) {
+    int ausentes = filtro->rejeitadas + filtro->falsosPositivos;
+    return ausentes > 0 ? 100.0 * filtro->falsosPositivos / ausentes : 0.0;
+}
+
+// Chave normalizada do registro i
+static inline const char* chaveRegistro(const void* registros, int i, size_t tamanhoRegistro,
+                                        size_t deslocamentoChave) {
+    return (const char*)registros + (size_t)i * tamanhoRegistro + deslocamentoChave;
+}
+
+int buscaSequencialChave(const void* registros, int n, size_t tamanhoRegistro,
+                         size_t deslocamentoChave, const char* chave, int* comparacoes) {
+    for (int i = 0; i < n; i++) {
+        CONTAR_LOCAL(*comparacoes);
+        if (strcmp(chaveRegistro(registros, i, tamanhoRegistro, deslocamentoChave), chave) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int buscaBinariaChave(const void* registros, int n, size_t tamanhoRegistro,
+                      size_t deslocamentoChave, const char* chave, int* comparacoes) {
+    int esquerda = 0;
+    int direita = n - 1;
+
+    while (esquerda <= direita) {
+        int meio = esquerda + (direita - esquerda) / 2;
+        CONTAR_LOCAL(*comparacoes);
+
+        int comparacao = strcmp(chaveRegistro(registros, meio, tamanhoRegistro, deslocamentoChave), chave);
+
+        if (comparacao == 0) {
+            return meio;
+        } else if (comparacao < 0) {
+            esquerda = meio + 1; // Busca na metade direita
+        } else {
+            direita = meio - 1; // Busca na metade esquerda
+        }
+    }
+
+    return -1;
+}
@@ -0,0 +1,127 @@
+/*
+ * Motor de Inventário
+ *
+ * Partes comuns aos três programas (novato, aventureiro e mestre), compiladas
+ * uma vez na biblioteca libinventario.a junto com radix, colacao e metricas:
+ * - Item e o cálculo das chaves normalizadas
+ * - limparBuffer() e lerTexto() para a leitura do menu
+ * - Tabela de registros (nome, tipo e um valor inteiro)
+ * - Filtro de Bloom em blocos sobre os nomes
+ * - Laços de busca sequencial e binária pela chave normalizada do nome
+ *
+ * As buscas recebem o registro como bytes (tamanho e deslocamento da chave),
+ * então servem tanto para Item quanto para Componente. Na compilação de
+ * produção (make, com LTO) elas são expandidas dentro de quem as chama, e o
+ * tamanho do registro vira uma constante como num laço escrito à mão.
+ */
+
+#ifndef INVENTARIO_H
+#define INVENTARIO_H
+
+#include <stddef.h>
+
+#define TAMANHO_NOME 30
+#define TAMANHO_TIPO 20
+#define BLOOM_BLOCOS 16      // Blocos de 512 bits (64 bytes, uma linha de cache)
+#define BLOOM_FUNCOES 4      // Bits ligados por nome dentro do bloco
+
+// Item do inventário (novato e aventureiro)
+typedef struct {
+    char nome[TAMANHO_NOME];      // Nome do item (ex: "AK-47", "Kit Médico")
+    char tipo[TAMANHO_TIPO];      // Tipo do item (ex: "arma", "munição", "cura")
+    int quantidade;               // Quantidade do item no inventário
+    char chaveNome[TAMANHO_NOME]; // Nome normalizado, usado no índice e nas buscas
+    char chaveTipo[TAMANHO_TIPO]; // Tipo normalizado, usado na classificação por tipo
+} Item;
+
+// Filtro de Bloom em blocos: cada nome liga BLOOM_FUNCOES bits em um único
+// bloco de 64 bytes, então descartar um nome ausente lê uma linha de cache
+typedef struct {
+    _Alignas(64) unsigned long long blocos[BLOOM_BLOCOS][8];
+    int elementos;        // Nomes inseridos desde a última reconstrução
+    int removidos;        // Nomes removidos desde a última reconstrução (bits continuam ligados)
+    int consultas;
+    int rejeitadas;       // Consultas descartadas pelo filtro
+    int falsosPositivos;  // Filtro respondeu "talvez" e o nome não existia
+} FiltroBloom;
+
+void limparBuffer();
+
+/*
+ * Lê uma linha da entrada em texto (até tamanho - 1 bytes), sem a quebra
+ * Se a linha não couber, descarta o resto dela, para que não vire a resposta
+ * da próxima pergunta, e retorna 0; retorna 1 se coube inteira
+ */
+int lerTexto(char texto[], int tamanho);
+
+/*
+ * Calcula as chaves normalizadas de nome e tipo do item
+ */
+void prepararChavesItem(Item* item);
+
+/*
+ * Tabela de registros; rotuloValor é o título da última coluna
+ * (ex: "Quantidade", "Prioridade") e rotuloOrdem o da primeira ("Nº", "Pos")
+ */
+void imprimirCabecalhoTabela(const char* rotuloOrdem, const char* rotuloValor);
+void imprimirLinhaTabela(int ordem, const char* nome, const char* tipo, int valor);
+void imprimirRodapeTabela();
+
+/*
+ * Hash FNV-1a de 64 bits do nome
+ * Os bits altos escolhem o bloco do filtro e os baixos as posições dentro dele
+ */
+unsigned long long hashNome(const char* nome);
+
+/*
+ * Deixa o filtro vazio e zera as estatísticas
+ */
+void inicializarBloom(FiltroBloom* filtro);
+
+/*
+ * Apaga os bits para uma reconstrução, mantendo as estatísticas de consultas
+ */
+void reiniciarBitsBloom(FiltroBloom* filtro);
+
+void adicionarBloom(FiltroBloom* filtro, const char* nome);
+
+/*
+ * Retorna 0 se o nome certamente não foi inserido, 1 se talvez tenha sido
+ */
+int consultarBloom(FiltroBloom* filtro, const char* nome);
+
+/*
+ * Registra o resultado da busca completa feita depois de um "talvez"
+ */
+void registrarResultadoBloom(FiltroBloom* filtro, int encontrado);
+
+/*
+ * Registra uma remoção; os bits do nome removido continuam ligados, então
+ * retorna 1 quando as remoções passam de 1/4 das inserções e o filtro
+ * deve ser reconstruído por quem conhece os nomes presentes
+ */
+int registrarRemocaoBloom(FiltroBloom* filtro);
+
+int bitsLigadosBloom(const FiltroBloom* filtro);
+
+/*
+ * Falsos positivos em porcentagem dos nomes ausentes consultados
+ * (só nomes ausentes podem virar falso positivo)
+ */
+double taxaFalsosPositivosBloom(const FiltroBloom* filtro);
+
+/*
+ * Busca sequencial pela chave em n registros de tamanhoRegistro bytes, cuja
+ * chave normalizada fica em deslocamentoChave (use offsetof)
+ * Acumula as comparações em *comparacoes; retorna o índice ou -1
+ */
+int buscaSequencialChave(const void* registros, int n, size_t tamanhoRegistro,
+                         size_t deslocamentoChave, const char* chave, int* comparacoes);
+
+/*
+ * Busca binária pela chave; os registros devem estar ordenados por ela
+ */
+int buscaBinariaChave(const void* registros, int n, size_t tamanhoRegistro,
+                      size_t deslocamentoChave, const char* chave, int* comparacoes);
+
+#endif
@@ -0,0 +1,441 @@
+/*
+ * Mapa de Mochilas por Jogador - implementação (veja jogadores.h)
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <time.h>
+
+#include "jogadores.h"
+#include "colacao.h"
+
+#define CAPACIDADE_INICIAL_MOCHILA 4
+#define TAMANHO_CHAVE_LOCAL 128  // Chaves maiores são normalizadas em um buffer do heap
+
+/*
+ * Espalha os bits do ID (finalizador do splitmix64)
+ * Os bits baixos escolhem o fragmento e os altos a posição dentro dele,
+ * então jogadores do mesmo fragmento não se amontoam na tabela
+ */
+static inline unsigned long long hashJogador(unsigned int jogador) {
+    unsigned long long hash = jogador + 0x9E3779B97F4A7C15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return hash ^ (hash >> 31);
+}
+
+static inline int posicaoIdeal(unsigned int jogador, int capacidade) {
+    return (int)((hashJogador(jogador) >> 32) & (unsigned long long)(capacidade - 1));
+}
+
+static unsigned long long relogioNs() {
+    struct timespec agora;
+    clock_gettime(CLOCK_MONOTONIC, &agora);
+    return (unsigned long long)agora.tv_sec * 1000000000ULL + (unsigned long long)agora.tv_nsec;
+}
+
+/*
+ * Trava o fragmento do jogador, contando a disputa quando a trava está ocupada
+ * O relógio só é lido quando há espera, então o caminho sem disputa fica barato
+ */
+static FragmentoMochilas* travarFragmento(MapaMochilas* mapa, unsigned int jogador) {
+    FragmentoMochilas* fragmento = &mapa->fragmentos[fragmentoDoJogador(mapa, jogador)];
+
+    if (pthread_mutex_trylock(&fragmento->trava) != 0) {
+        unsigned long long inicio = relogioNs();
+        pthread_mutex_lock(&fragmento->trava);
+        fragmento->disputas++;
+        fragmento->esperaNs += relogioNs() - inicio;
+    }
+    fragmento->aquisicoes++;
+    return fragmento;
+}
+
+int fragmentoDoJogador(const MapaMochilas* mapa, unsigned int jogador) {
+    return (int)(hashJogador(jogador) & (unsigned long long)(mapa->totalFragmentos - 1));
+}
+
+int inicializarMapaMochilas(MapaMochilas* mapa, int fragmentos, int limiteItens) {
+    int total = 1;
+    while (total < fragmentos && total < MAX_FRAGMENTOS) {
+        total *= 2;
+    }
+
+    mapa->totalFragmentos = total;
+    mapa->limiteItens = limiteItens;
+    mapa->fragmentos = (FragmentoMochilas*)aligned_alloc(64, (size_t)total * sizeof(FragmentoMochilas));
+    if (mapa->fragmentos == NULL) {
+        return 0;
+    }
+
+    for (int i = 0; i < total; i++) {
+        FragmentoMochilas* fragmento = &mapa->fragmentos[i];
+        memset(fragmento, 0, sizeof(FragmentoMochilas));
+        pthread_mutex_init(&fragmento->trava, NULL);
+        inicializarArena(&fragmento->arena);
+        fragmento->capacidade = CAPACIDADE_INICIAL_FRAGMENTO;
+        fragmento->tabela = (Mochila*)calloc(CAPACIDADE_INICIAL_FRAGMENTO, sizeof(Mochila));
+        if (fragmento->tabela == NULL) {
+            mapa->totalFragmentos = i + 1;
+            liberarMapaMochilas(mapa);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void liberarMapaMochilas(MapaMochilas* mapa) {
+    if (mapa->fragmentos == NULL) {
+        return;
+    }
+    for (int i = 0; i < mapa->totalFragmentos; i++) {
+        FragmentoMochilas* fragmento = &mapa->fragmentos[i];
+        if (fragmento->tabela != NULL) {
+            for (int p = 0; p < fragmento->capacidade; p++) {
+                free(fragmento->tabela[p].itens);
+            }
+            free(fragmento->tabela);
+        }
+        liberarArena(&fragmento->arena);
+        pthread_mutex_destroy(&fragmento->trava);
+    }
+    free(mapa->fragmentos);
+    mapa->fragmentos = NULL;
+    mapa->totalFragmentos = 0;
+}
+
+/*
+ * Posição da mochila do jogador na tabela, ou -1
+ */
+static int buscarMochila(const FragmentoMochilas* fragmento, unsigned int jogador) {
+    int mascara = fragmento->capacidade - 1;
+    int posicao = posicaoIdeal(jogador, fragmento->capacidade);
+
+    while (fragmento->tabela[posicao].ocupada) {
+        if (fragmento->tabela[posicao].jogador == jogador) {
+            return posicao;
+        }
+        posicao = (posicao + 1) & mascara;
+    }
+    return -1;
+}
+
+/*
+ * Dobra a tabela do fragmento e reposiciona as mochilas; retorna 0 se faltar memória
+ */
+static int crescerFragmento(FragmentoMochilas* fragmento) {
+    int novaCapacidade = fragmento->capacidade * 2;
+    Mochila* novaTabela = (Mochila*)calloc((size_t)novaCapacidade, sizeof(Mochila));
+    if (novaTabela == NULL) {
+        return 0;
+    }
+
+    for (int p = 0; p < fragmento->capacidade; p++) {
+        if (fragmento->tabela[p].ocupada) {
+            int posicao = posicaoIdeal(fragmento->tabela[p].jogador, novaCapacidade);
+            while (novaTabela[posicao].ocupada) {
+                posicao = (posicao + 1) & (novaCapacidade - 1);
+            }
+            novaTabela[posicao] = fragmento->tabela[p];
+        }
+    }
+
+    free(fragmento->tabela);
+    fragmento->tabela = novaTabela;
+    fragmento->capacidade = novaCapacidade;
+    fragmento->redimensionamentos++;
+    return 1;
+}
+
+/*
+ * Mochila do jogador, criada vazia se ele ainda não tiver uma
+ * Mantém a tabela com no máximo 3/4 das posições ocupadas
+ */
+static Mochila* obterMochila(FragmentoMochilas* fragmento, unsigned int jogador) {
+    int posicao = buscarMochila(fragmento, jogador);
+    if (posicao != -1) {
+        return &fragmento->tabela[posicao];
+    }
+
+    if ((fragmento->jogadores + 1) * 4 > fragmento->capacidade * 3 && !crescerFragmento(fragmento)) {
+        return NULL;
+    }
+
+    posicao = posicaoIdeal(jogador, fragmento->capacidade);
+    while (fragmento->tabela[posicao].ocupada) {
+        posicao = (posicao + 1) & (fragmento->capacidade - 1);
+    }
+
+    Mochila* mochila = &fragmento->tabela[posicao];
+    memset(mochila, 0, sizeof(Mochila));
+    mochila->jogador = jogador;
+    mochila->ocupada = 1;
+    fragmento->jogadores++;
+    return mochila;
+}
+
+/*
+ * Tira a mochila da posição sem deixar marcas de remoção: as mochilas seguintes
+ * da mesma sequência recuam para a lacuna quando isso não as coloca antes
+ * da sua posição ideal
+ */
+static void liberarPosicao(FragmentoMochilas* fragmento, int posicao) {
+    int mascara = fragmento->capacidade - 1;
+    int lacuna = posicao;
+    int atual = posicao;
+
+    free(fragmento->tabela[posicao].itens);
+    while (1) {
+        atual = (atual + 1) & mascara;
+        if (!fragmento->tabela[atual].ocupada) {
+            break;
+        }
+        int ideal = posicaoIdeal(fragmento->tabela[atual].jogador, fragmento->capacidade);
+        // A lacuna está entre a posição ideal e a atual (circularmente)
+        if (((atual - ideal) & mascara) >= ((atual - lacuna) & mascara)) {
+            fragmento->tabela[lacuna] = fragmento->tabela[atual];
+            lacuna = atual;
+        }
+    }
+    memset(&fragmento->tabela[lacuna], 0, sizeof(Mochila));
+    fragmento->jogadores--;
+}
+
+/*
+ * Chave normalizada do nome; usa o buffer local quando cabe e o heap
+ * quando não (libere com liberarChave)
+ */
+static char* normalizarChave(const char* nome, char local[]) {
+    size_t tamanho = strlen(nome) + 1; // A chave nunca é maior que o texto
+    char* chave = tamanho <= TAMANHO_CHAVE_LOCAL ? local : (char*)malloc(tamanho);
+    if (chave != NULL) {
+        normalizarTexto(nome, chave, (int)tamanho);
+    }
+    return chave;
+}
+
+static void liberarChave(char* chave, const char local[]) {
+    if (chave != local) {
+        free(chave);
+    }
+}
+
+static int buscarItemMochila(const FragmentoMochilas* fragmento, const Mochila* mochila,
+                             const char* chave, size_t tamanhoChave) {
+    for (int i = 0; i < mochila->totalItens; i++) {
+        if (nomeIgual(&fragmento->arena, &mochila->itens[i].chaveNome, chave, tamanhoChave)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void descartarItem(FragmentoMochilas* fragmento, const ItemMochila* item) {
+    descartarNome(&fragmento->arena, &item->nome);
+    descartarNome(&fragmento->arena, &item->chaveNome);
+    descartarNome(&fragmento->arena, &item->tipo);
+}
+
+/*
+ * Copia os textos vivos para uma arena nova quando metade da atual é lixo
+ * A nova já nasce com o tamanho exato dos vivos, então mover não falha;
+ * sem memória para ela, continua com a atual
+ */
+static void compactarSePreciso(FragmentoMochilas* fragmento) {
+    ArenaNomes* atual = &fragmento->arena;
+    if (atual->lixo < LIXO_MINIMO_COMPACTACAO || atual->lixo * 2 < atual->usados) {
+        return;
+    }
+
+    ArenaNomes nova;
+    inicializarArena(&nova);
+    if (!reservarArena(&nova, atual->usados - atual->lixo)) {
+        return;
+    }
+    for (int p = 0; p < fragmento->capacidade; p++) {
+        Mochila* mochila = &fragmento->tabela[p];
+        for (int i = 0; mochila->ocupada && i < mochila->totalItens; i++) {
+            moverNome(atual, &nova, &mochila->itens[i].nome);
+            moverNome(atual, &nova, &mochila->itens[i].chaveNome);
+            moverNome(atual, &nova, &mochila->itens[i].tipo);
+        }
+    }
+
+    liberarArena(atual);
+    *atual = nova;
+    fragmento->compactacoes++;
+}
+
+ResultadoMochila adicionarItemJogador(MapaMochilas* mapa, unsigned int jogador, const char* nome,
+                                      const char* tipo, int quantidade) {
+    char local[TAMANHO_CHAVE_LOCAL];
+    char* chave = normalizarChave(nome, local);
+    if (chave == NULL) {
+        return MOCHILA_SEM_MEMORIA;
+    }
+    size_t tamanhoChave = strlen(chave);
+
+    FragmentoMochilas* fragmento = travarFragmento(mapa, jogador);
+    ResultadoMochila resultado = MOCHILA_INSERIDO;
+    Mochila* mochila = obterMochila(fragmento, jogador);
+
+    if (mochila == NULL) {
+        resultado = MOCHILA_SEM_MEMORIA;
+    } else {
+        int indice = buscarItemMochila(fragmento, mochila, chave, tamanhoChave);
+        if (indice != -1) {
+            mochila->itens[indice].quantidade += quantidade;
+            resultado = MOCHILA_SOMADO;
+        } else if (mochila->totalItens >= mapa->limiteItens) {
+            resultado = MOCHILA_CHEIA;
+        } else {
+            if (mochila->totalItens == mochila->capacidadeItens) {
+                int novaCapacidade = mochila->capacidadeItens > 0 ? mochila->capacidadeItens * 2
+                                                                  : CAPACIDADE_INICIAL_MOCHILA;
+                if (novaCapacidade > mapa->limiteItens) {
+                    novaCapacidade = mapa->limiteItens;
+                }
+                ItemMochila* novosItens =
+                    (ItemMochila*)realloc(mochila->itens, (size_t)novaCapacidade * sizeof(ItemMochila));
+                if (novosItens == NULL) {
+                    resultado = MOCHILA_SEM_MEMORIA;
+                } else {
+                    mochila->itens = novosItens;
+                    mochila->capacidadeItens = novaCapacidade;
+                }
+            }
+            if (resultado == MOCHILA_INSERIDO) {
+                ItemMochila* item = &mochila->itens[mochila->totalItens];
+                int guardados = guardarNome(&fragmento->arena, nome, strlen(nome), &item->nome) +
+                                guardarNome(&fragmento->arena, chave, tamanhoChave, &item->chaveNome) +
+                                guardarNome(&fragmento->arena, tipo, strlen(tipo), &item->tipo);
+                if (guardados == 3) {
+                    item->quantidade = quantidade;
+                    mochila->totalItens++;
+                    fragmento->itens++;
+                } else {
+                    // Um texto que não coube: os que entraram viram lixo
+                    // (guardarNome zera o registro que falhou, que então não conta)
+                    descartarItem(fragmento, item);
+                    resultado = MOCHILA_SEM_MEMORIA;
+                }
+            }
+        }
+
+        // Não deixa mochila vazia para trás quando o primeiro item não entrou
+        if (mochila->totalItens == 0) {
+            liberarPosicao(fragmento, (int)(mochila - fragmento->tabela));
+        }
+    }
+
+    pthread_mutex_unlock(&fragmento->trava);
+    liberarChave(chave, local);
+    return resultado;
+}
+
+int removerItemJogador(MapaMochilas* mapa, unsigned int jogador, const char* nome) {
+    char local[TAMANHO_CHAVE_LOCAL];
+    char* chave = normalizarChave(nome, local);
+    if (chave == NULL) {
+        return 0;
+    }
+    size_t tamanhoChave = strlen(chave);
+
+    FragmentoMochilas* fragmento = travarFragmento(mapa, jogador);
+    int removido = 0;
+    int posicao = buscarMochila(fragmento, jogador);
+
+    if (posicao != -1) {
+        Mochila* mochila = &fragmento->tabela[posicao];
+        int indice = buscarItemMochila(fragmento, mochila, chave, tamanhoChave);
+        if (indice != -1) {
+            // A ordem dos itens não importa; o último ocupa o lugar do removido
+            descartarItem(fragmento, &mochila->itens[indice]);
+            mochila->itens[indice] = mochila->itens[mochila->totalItens - 1];
+            mochila->totalItens--;
+            fragmento->itens--;
+            removido = 1;
+            if (mochila->totalItens == 0) {
+                liberarPosicao(fragmento, posicao);
+            }
+            compactarSePreciso(fragmento);
+        }
+    }
+
+    pthread_mutex_unlock(&fragmento->trava);
+    liberarChave(chave, local);
+    return removido;
+}
+
+int consultarItemJogador(MapaMochilas* mapa, unsigned int jogador, const char* nome, int* quantidade) {
+    char local[TAMANHO_CHAVE_LOCAL];
+    char* chave = normalizarChave(nome, local);
+    if (chave == NULL) {
+        return 0;
+    }
+    size_t tamanhoChave = strlen(chave);
+
+    FragmentoMochilas* fragmento = travarFragmento(mapa, jogador);
+    int encontrado = 0;
+    int posicao = buscarMochila(fragmento, jogador);
+
+    if (posicao != -1) {
+        const Mochila* mochila = &fragmento->tabela[posicao];
+        int indice = buscarItemMochila(fragmento, mochila, chave, tamanhoChave);
+        if (indice != -1) {
+            *quantidade = mochila->itens[indice].quantidade;
+            encontrado = 1;
+        }
+    }
+
+    pthread_mutex_unlock(&fragmento->trava);
+    liberarChave(chave, local);
+    return encontrado;
+}
+
+int percorrerMochila(MapaMochilas* mapa, unsigned int jogador, VisitanteItemJogador visitar, void* contexto) {
+    FragmentoMochilas* fragmento = travarFragmento(mapa, jogador);
+    int visitados = 0;
+    int posicao = buscarMochila(fragmento, jogador);
+
+    if (posicao != -1) {
+        const Mochila* mochila = &fragmento->tabela[posicao];
+        for (; visitados < mochila->totalItens; visitados++) {
+            const ItemMochila* item = &mochila->itens[visitados];
+            visitar(textoNome(&fragmento->arena, &item->nome), textoNome(&fragmento->arena, &item->tipo),
+                    item->quantidade, contexto);
+        }
+    }
+
+    pthread_mutex_unlock(&fragmento->trava);
+    return visitados;
+}
+
+void lerEstatisticasFragmento(MapaMochilas* mapa, int fragmento, EstatisticasFragmento* estatisticas) {
+    FragmentoMochilas* alvo = &mapa->fragmentos[fragmento];
+
+    // Lê sem passar por travarFragmento para a leitura não se contar como aquisição
+    pthread_mutex_lock(&alvo->trava);
+    estatisticas->jogadores = alvo->jogadores;
+    estatisticas->itens = alvo->itens;
+    estatisticas->bytesArena = alvo->arena.usados;
+    estatisticas->lixoArena = alvo->arena.lixo;
+    estatisticas->compactacoes = alvo->compactacoes;
+    estatisticas->aquisicoes = alvo->aquisicoes;
+    estatisticas->disputas = alvo->disputas;
+    estatisticas->esperaNs = alvo->esperaNs;
+    estatisticas->redimensionamentos = alvo->redimensionamentos;
+    pthread_mutex_unlock(&alvo->trava);
+}
+
+void zerarDisputasMapa(MapaMochilas* mapa) {
+    for (int i = 0; i < mapa->totalFragmentos; i++) {
+        FragmentoMochilas* fragmento = &mapa->fragmentos[i];
+        pthread_mutex_lock(&fragmento->trava);
+        fragmento->aquisicoes = 0;
+        fragmento->disputas = 0;
+        fragmento->esperaNs = 0;
+        pthread_mutex_unlock(&fragmento->trava);
+    }
+}
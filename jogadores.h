@@ -0,0 +1,144 @@
+/*
+ * Mapa de Mochilas por Jogador
+ *
+ * Guarda uma mochila (vetor de itens) para cada jogador de um servidor, com
+ * centenas de milhares de jogadores acessados por várias threads ao mesmo tempo.
+ *
+ * O mapa é dividido em fragmentos pelo hash do ID do jogador. Cada fragmento
+ * tem sua própria trava e sua própria tabela hash (endereçamento aberto com
+ * sondagem linear), e ocupa linhas de cache só suas. Operações em jogadores de
+ * fragmentos diferentes não disputam nada, então a vazão cresce com o número
+ * de núcleos enquanto houver bem mais fragmentos que threads. Crescer a tabela
+ * também é local: só o fragmento que encheu é travado.
+ *
+ * Nomes e tipos ficam na arena de nomes do fragmento (arena.h): um item ocupa
+ * 52 bytes, metade de um Item, nomes curtos nem chegam à arena e não há
+ * limite de tamanho. A arena é compactada quando metade dela vira lixo.
+ *
+ * A normalização do nome (colacao.h) é feita antes de travar, e nenhum
+ * ponteiro para dentro do mapa escapa da trava: as consultas devolvem valores
+ * e percorrerMochila() visita os itens com o fragmento travado.
+ *
+ * Cada fragmento conta suas aquisições e quantas encontraram a trava ocupada,
+ * com o tempo de espera; veja lerEstatisticasFragmento().
+ */
+
+#ifndef JOGADORES_H
+#define JOGADORES_H
+
+#include <pthread.h>
+
+#include "arena.h"
+
+#define MAX_FRAGMENTOS 1024
+#define CAPACIDADE_INICIAL_FRAGMENTO 16  // Posições da tabela de um fragmento novo
+#define LIXO_MINIMO_COMPACTACAO 4096     // Bytes de lixo na arena antes de considerar compactar
+
+// Item de uma mochila; os textos ficam na arena do fragmento
+typedef struct {
+    NomeCompacto nome;
+    NomeCompacto chaveNome;   // Nome normalizado, usado nas buscas
+    NomeCompacto tipo;
+    int quantidade;
+} ItemMochila;
+
+// Mochila de um jogador; a posição da tabela está livre quando ocupada == 0
+typedef struct {
+    unsigned int jogador;
+    int ocupada;
+    int totalItens;
+    int capacidadeItens;
+    ItemMochila* itens;
+} Mochila;
+
+// Um fragmento ocupa um múltiplo de 64 bytes, então a trava de um não
+// divide linha de cache com a de outro
+typedef struct {
+    _Alignas(64) pthread_mutex_t trava;
+    Mochila* tabela;
+    int capacidade;      // Potência de 2
+    int jogadores;
+    long itens;
+    ArenaNomes arena;    // Nomes e tipos longos das mochilas deste fragmento
+    unsigned long long compactacoes;
+
+    // Estatísticas de disputa (escritas com a trava)
+    unsigned long long aquisicoes;
+    unsigned long long disputas;          // Aquisições que encontraram a trava ocupada
+    unsigned long long esperaNs;          // Tempo total esperando nas disputas
+    unsigned long long redimensionamentos;
+} FragmentoMochilas;
+
+typedef struct {
+    FragmentoMochilas* fragmentos;
+    int totalFragmentos;   // Potência de 2
+    int limiteItens;       // Itens distintos por mochila
+} MapaMochilas;
+
+// Cópia das estatísticas de um fragmento
+typedef struct {
+    int jogadores;
+    long itens;
+    unsigned int bytesArena;       // Ocupados na arena, incluindo o lixo
+    unsigned int lixoArena;
+    unsigned long long compactacoes;
+    unsigned long long aquisicoes;
+    unsigned long long disputas;
+    unsigned long long esperaNs;
+    unsigned long long redimensionamentos;
+} EstatisticasFragmento;
+
+typedef enum {
+    MOCHILA_INSERIDO,     // Item novo na mochila
+    MOCHILA_SOMADO,       // O item já existia; a quantidade foi somada
+    MOCHILA_CHEIA,        // A mochila já tem limiteItens itens distintos
+    MOCHILA_SEM_MEMORIA
+} ResultadoMochila;
+
+// Recebe cada item de percorrerMochila(); os textos só valem durante a chamada
+typedef void (*VisitanteItemJogador)(const char* nome, const char* tipo, int quantidade, void* contexto);
+
+/*
+ * Cria o mapa com fragmentos arredondados para a próxima potência de 2
+ * (até MAX_FRAGMENTOS); retorna 0 se faltar memória
+ */
+int inicializarMapaMochilas(MapaMochilas* mapa, int fragmentos, int limiteItens);
+
+void liberarMapaMochilas(MapaMochilas* mapa);
+
+/*
+ * Acrescenta o item à mochila do jogador, criando a mochila se preciso
+ */
+ResultadoMochila adicionarItemJogador(MapaMochilas* mapa, unsigned int jogador, const char* nome,
+                                      const char* tipo, int quantidade);
+
+/*
+ * Remove o item da mochila; a mochila que fica vazia sai do mapa
+ * Retorna 1 se o item existia
+ */
+int removerItemJogador(MapaMochilas* mapa, unsigned int jogador, const char* nome);
+
+/*
+ * Quantidade do item em *quantidade; retorna 1 se o jogador tem o item
+ */
+int consultarItemJogador(MapaMochilas* mapa, unsigned int jogador, const char* nome, int* quantidade);
+
+/*
+ * Visita os itens da mochila com o fragmento travado (o visitante não pode
+ * usar o mapa); retorna quantos itens visitou, 0 se o jogador não tem mochila
+ */
+int percorrerMochila(MapaMochilas* mapa, unsigned int jogador, VisitanteItemJogador visitar, void* contexto);
+
+/*
+ * Fragmento que guarda o jogador
+ */
+int fragmentoDoJogador(const MapaMochilas* mapa, unsigned int jogador);
+
+void lerEstatisticasFragmento(MapaMochilas* mapa, int fragmento, EstatisticasFragmento* estatisticas);
+
+/*
+ * Zera as contagens de aquisições, disputas e espera de todos os fragmentos
+ */
+void zerarDisputasMapa(MapaMochilas* mapa);
+
+#endif
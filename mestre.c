@@ -9,58 +9,305 @@
  * - Bubble Sort (ordenação por nome)
  * - Insertion Sort (ordenação por tipo)
  * - Selection Sort (ordenação por prioridade)
+ * - Counting Sort (ordenação estável por prioridade em O(n + 10))
+ * - Natural Merge Sort (ordenação por nome aproveitando trechos já ordenados)
+ * - Ordenação incremental: cadastros fora de ordem vão para uma cauda curta,
+ *   buscada em sequência, e são intercalados em lote quando ela enche
+ * - Fila de Buckets (retirada do componente de maior prioridade)
+ * - Heap d-ário de montagem (componentes consumidos em ordem de prioridade)
+ * - Armazenamento colunar (nomes, tipos e prioridades em vetores separados)
+ * - Consultas por filtro (tipo e faixa de prioridade) como mapas de bits
+ *   produzidos por varreduras SSE2 das colunas (selecao.h)
+ * - Merge Sort paralelo (ordenação por nome com várias threads)
  * - Busca Binária (busca por nome em array ordenado)
+ * - Busca por Interpolação e Busca Exponencial, com escolha automática
+ * - Busca aproximada por distância de edição (Myers bit-paralelo), para erros de digitação
+ * - Leitura concorrente por versões publicadas (RCU com recuperação por épocas)
+ * - Filtro de Bloom em blocos que descarta nomes ausentes antes das buscas
+ * - Montagem paralela por grafo de dependências com roubo de trabalho
+ * - Registro de métricas por thread (metricas.h) com exportação em JSON
+ * - Estados congelados copy-on-write: os testes de escala ordenam bifurcações
+ *   descartáveis da entrada gerada em vez de manter uma segunda cópia
+ *
+ * - Motor de ordenação genérico (ordenacao.h) com comparador embutido por chave
+ * - Árvore radix de nomes (radix.h): busca exata, por prefixo e em ordem alfabética
+ * - Chaves de colação (colacao.h): ordenação e busca sem diferenciar maiúsculas e acentos
+ * - Importação em lote de CSV/TSV com arquivo mapeado em memória e análise paralela
+ *
+ * Filtro de Bloom, tabela e laços de busca vêm do motor compartilhado (inventario.h).
+ * Compile com make; make INSTRUMENTACAO=0 remove as contagens dos laços internos,
+ * e a opção "Medir custo da instrumentação" compara as duas compilações
  */
 
+#define _GNU_SOURCE  // pthread_attr_setaffinity_np e CPU_SET
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <stddef.h>
+
+#include "inventario.h"
+#include "metricas.h"
+#include "ordenacao.h"
+#include "radix.h"
+#include "colacao.h"
+#include "aproximada.h"
+#include "selecao.h"
 
 // Definição da estrutura Componente
 typedef struct {
     char nome[30];      // Nome do componente (ex: "chip central")
     char tipo[20];      // Tipo (ex: "controle", "suporte", "propulsão")
     int prioridade;     // Prioridade de 1 a 10
+    char chaveNome[30]; // Nome normalizado, usado em toda ordenação e busca por nome
+    char chaveTipo[20]; // Tipo normalizado, usado na ordenação e classificação por tipo
 } Componente;
 
 // Constantes do sistema
 #define MAX_COMPONENTES 20
-#define TAMANHO_NOME 30
-#define TAMANHO_TIPO 20
+#define LIMITE_CAUDA 4  // Cadastros fora de ordem aceitos antes de intercalar (≈ √MAX_COMPONENTES)
+#define PRIORIDADE_MIN 1
+#define PRIORIDADE_MAX 10
+#define TOTAL_PRIORIDADES (PRIORIDADE_MAX - PRIORIDADE_MIN + 1)
+#define MAX_THREADS 16
+#define ARIDADE_HEAP 4       // Filhos por nó do heap de montagem
+#define TOTAL_FASES 5        // Base, controle, propulsão, componente-chave, teste final
+#define UNIDADE_TRABALHO 20000 // Iterações simuladas por ponto de prioridade
+#define MAX_LEITORES 64
+#define MAX_TORRES_MONTAGEM 10000  // Torres por simulação de montagem paralela
+#define EPOCA_INATIVA (~0ULL)
+
+// Fila de buckets: um balde por prioridade, encadeado por índices em torre
+typedef struct {
+    int inicio[TOTAL_PRIORIDADES];       // Primeiro índice de cada balde (-1 se vazio)
+    int fim[TOTAL_PRIORIDADES];          // Último índice de cada balde (-1 se vazio)
+    int proximo[MAX_COMPONENTES];        // Próximo índice no mesmo balde
+    int maiorOcupado;                    // Maior balde possivelmente não vazio
+    int total;                           // Componentes ainda na fila
+} FilaBuckets;
+
+// Algoritmos de busca por nome em array ordenado
+typedef enum {
+    BUSCA_BINARIA,
+    BUSCA_INTERPOLACAO,
+    BUSCA_EXPONENCIAL
+} AlgoritmoBusca;
+
+// Entrada do heap de montagem: só a chave e a posição, 8 bytes por componente
+typedef struct {
+    int prioridade;
+    int indice;      // Posição do componente em torre
+} EntradaHeap;
+
+// Heap d-ário de máximo por prioridade (empate: menor posição em torre primeiro)
+typedef struct {
+    EntradaHeap itens[MAX_COMPONENTES];
+    int total;
+} HeapMontagem;
+
+// Categorias de tipo usadas nas estatísticas e na verificação da montagem
+typedef enum {
+    CATEGORIA_CONTROLE,
+    CATEGORIA_SUPORTE,
+    CATEGORIA_PROPULSAO,
+    CATEGORIA_OUTROS,
+    TOTAL_CATEGORIAS
+} CategoriaTipo;
+
+// Armazenamento colunar da torre, em ordem de cadastro
+// Cada campo fica em um vetor contíguo próprio: uma varredura por prioridade
+// lê 1 byte por componente em vez dos 104 bytes de um Componente inteiro
+typedef struct {
+    char nomes[MAX_COMPONENTES][TAMANHO_NOME];            // Coluna de nomes
+    unsigned char tipoIds[MAX_COMPONENTES];               // Coluna de tipos (índice no dicionário)
+    unsigned char prioridades[MAX_COMPONENTES];           // Coluna de prioridades
+    char dicionarioTipos[MAX_COMPONENTES][TAMANHO_TIPO];  // Texto de cada tipo distinto
+    unsigned char categoriaTipo[MAX_COMPONENTES];         // Categoria de cada tipo distinto
+    unsigned char sistemasTipo[MAX_COMPONENTES];          // Sistemas que cada tipo atende (veja sistemasDoTipo)
+    int totalTipos;
+    int total;
+} TorreColunar;
+
+// Versão imutável da torre publicada para os leitores
+// Depois de publicada nunca é alterada: o escritor monta uma nova versão e
+// troca o ponteiro publicado; a antiga só é liberada quando nenhum leitor
+// que possa estar com ela ainda estiver ativo
+typedef struct VersaoTorre {
+    int total;
+    int ordenadoPorNome;
+    int caudaNome;                          // Últimos itens ainda fora da ordem por nome
+    int ordenadoPorTipo;
+    int ordenadoPorPrioridade;
+    int categorias[TOTAL_CATEGORIAS];
+    AlgoritmoBusca buscaRecomendada;        // Escolhida pelo escritor ao publicar
+    struct VersaoTorre* proximaAposentada;  // Lista de versões aguardando liberação
+    unsigned long long epocaAposentadoria;  // Época em que deixou de ser publicada
+    Componente itens[];
+} VersaoTorre;
+
+// Época anunciada por um leitor, um por linha de cache para evitar falso compartilhamento
+typedef struct {
+    _Alignas(64) _Atomic unsigned long long epoca;  // EPOCA_INATIVA fora de uma leitura
+    atomic_int ocupado;
+    char preenchimento[64 - sizeof(unsigned long long) - sizeof(int)];
+} SlotLeitor;
+
+// Estado congelado de um vetor de componentes (veja congelarEstado)
+// Cada bifurcação é uma visão privada copy-on-write do mesmo memfd
+typedef struct {
+    int descritor;             // memfd com o estado; -1 quando não há memfd
+    size_t bytes;
+    int n;
+    Componente* copiaReserva;  // Sem memfd, o estado fica aqui e cada bifurcação é uma cópia
+} EstadoCongelado;
+
+// Tipos sorteados por gerarComponentesAleatorios
+static const char* const tiposGerados[] = {"controle", "suporte", "propulsão", "outros"};
+#define TOTAL_TIPOS_GERADOS ((int)(sizeof(tiposGerados) / sizeof(tiposGerados[0])))
 
 // Variáveis globais
 Componente torre[MAX_COMPONENTES];
 int totalComponentes = 0;
 int ordenadoPorNome = 0;    // Flag para indicar se está ordenado por nome
+int caudaNome = 0;          // Com ordenadoPorNome, quantos itens do fim ainda não foram intercalados
+int ordenacaoIncremental = 1;  // Cadastros fora de ordem vão para a cauda em vez de desfazer a ordem
+int intercalacoesCauda = 0;    // Quantas vezes a cauda foi intercalada no corpo
 int ordenadoPorTipo = 0;    // Flag para indicar se está ordenado por tipo
 int ordenadoPorPrioridade = 0; // Flag para indicar se está ordenado por prioridade
+TorreColunar colunas;          // Cópia colunar de torre, usada nas varreduras por campo
+FiltroBloom filtroNomes;       // Filtro dos nomes cadastrados em torre
+ArvoreRadix arvoreNomes;       // Nome -> posição em colunas (que nunca é reordenada)
+
+// Métricas de comparações (identificadores no registro de metricas.h)
+// As buscas são histogramas: a soma é o total de comparações e os baldes
+// mostram a distribuição de comparações por busca
+int metricaBubble;
+int metricaInsertion;
+int metricaSelection;
+int metricaBusca;
+int metricaInterpolacao;
+int metricaExponencial;
+int metricaCounting;  // Counting Sort não compara: conta acessos à chave
+int metricaMerge;
+int metricaHeap;
+int metricaNatural;
+int metricaImportadas;   // Linhas válidas lidas pela importação em lote
+int metricaRejeitadas;   // Linhas descartadas pela validação da importação
+
+// Número de threads usadas pelo Merge Sort paralelo
+int threadsMergeSort = 4;
 
-// Contadores de comparações
-int comparacoesBubble = 0;
-int comparacoesInsertion = 0;
-int comparacoesSelection = 0;
-int comparacoesBusca = 0;
+// Estado da leitura concorrente (RCU)
+_Atomic(VersaoTorre*) versaoPublicada = NULL;
+_Atomic unsigned long long epocaGlobal = 1;
+SlotLeitor slotsLeitores[MAX_LEITORES];
+_Thread_local int slotLeitorAtual = -1;     // Slot da thread leitora atual
+pthread_mutex_t mutexEscrita = PTHREAD_MUTEX_INITIALIZER;
+VersaoTorre* versoesAposentadas = NULL;    // Protegida por mutexEscrita
+int versoesPublicadas = 0;
+int versoesLiberadas = 0;
 
 // Declaração das funções principais
 void exibirMenuPrincipal();
 void cadastrarComponente();
 void mostrarComponentes();
-void limparBuffer();
+void prepararChaves(Componente* c);
+void registrarMetricasTorre();
 void resetarContadores();
+void exportarMetricas();
 void exibirEstatisticas();
 
 // Funções de ordenação
 void bubbleSortNome(Componente arr[], int n);
 void insertionSortTipo(Componente arr[], int n);
 void selectionSortPrioridade(Componente arr[], int n);
+void countingSortPrioridade(Componente arr[], int n);
+void naturalSortNome(Componente arr[], int n);
+void intercalarCaudaNome();
+void mergeSortParaleloNome(Componente arr[], int n, int numThreads);
+void mergeSortNome(Componente arr[], int n);
+
+// Funções da fila de buckets por prioridade
+void inicializarFilaBuckets(FilaBuckets* fila);
+void inserirFilaBuckets(FilaBuckets* fila, Componente arr[], int indice);
+int retirarMaiorPrioridade(FilaBuckets* fila);
+void retirarPorPrioridade();
+
+// Funções do heap de montagem
+void construirHeapMontagem(HeapMontagem* heap, const Componente arr[], int n);
+int retirarHeapMontagem(HeapMontagem* heap);
+
+// Funções do armazenamento colunar
+void adicionarColunar(TorreColunar* tc, const Componente* c);
+const char* nomeColunar(const TorreColunar* tc, int i);
+const char* tipoColunar(const TorreColunar* tc, int i);
+int prioridadeColunar(const TorreColunar* tc, int i);
+Componente obterComponenteColunar(const TorreColunar* tc, int i);
+void histogramaPrioridades(const TorreColunar* tc, int histograma[]);
+int contarPrioridadeMinima(const TorreColunar* tc, int minimo);
+void contarCategorias(const TorreColunar* tc, int contadores[]);
+int selecionarTipoColunar(const TorreColunar* tc, const char* chaveTipo, unsigned long long selecao[]);
+CategoriaTipo classificarTipo(const char* tipo);
+int sistemasDoTipo(const char* tipo);
+int sistemasPresentes(const TorreColunar* tc);
+void compararArmazenamento();
+
+// Consultas por filtro
+void filtrarComponentes();
+void testarEscalaFiltros();
 
 // Função de busca
-int buscaBinariaPorNome(Componente arr[], int n, char nome[]);
+int buscaBinariaPorNome(const Componente arr[], int n, const char nome[]);
+int buscaBinariaContando(const Componente arr[], int n, const char nome[], int* comparacoes);
+int buscaCaudaContando(const Componente arr[], int n, int cauda, const char nome[], int* comparacoes);
+int buscaInterpolacaoPorNome(const Componente arr[], int n, const char nome[]);
+int buscaInterpolacaoContando(const Componente arr[], int n, const char nome[], int* comparacoes);
+int buscaExponencialPorNome(const Componente arr[], int n, const char nome[]);
+int buscaExponencialContando(const Componente arr[], int n, const char nome[], int* comparacoes);
+AlgoritmoBusca escolherBusca(const Componente arr[], int n);
+void buscarNomeAproximado();
+void testarEscalaBuscaAproximada();
+const char* nomeAlgoritmoBusca(AlgoritmoBusca algoritmo);
+
+// Funções da leitura concorrente
+VersaoTorre* criarVersao(int total);
+void publicarVersao(VersaoTorre* nova);
+void publicarVersaoTorre();
+const VersaoTorre* entrarLeitura();
+void sairLeitura();
+void liberarSlotLeitor();
+void simularLeitoresConcorrentes();
+
+// Montagem paralela por grafo de dependências
+void simularMontagemParalela();
+
+// Estados congelados para as medições
+int congelarEstado(EstadoCongelado* estado, const Componente arr[], int n);
+Componente* bifurcarEstado(const EstadoCongelado* estado);
+void prepararBifurcacao(const EstadoCongelado* estado, Componente* bifurcacao);
+void descartarBifurcacao(const EstadoCongelado* estado, Componente* bifurcacao);
+void liberarEstado(EstadoCongelado* estado);
 
 // Funções de medição e análise
 double medirTempo(void (*algoritmo)(Componente[], int), Componente arr[], int n);
+double relogioParede();
 void compararAlgoritmos();
+void compararAlgoritmosParalelo();
+void gerarComponentesAleatorios(Componente arr[], int n);
+void testarEscalaMergeSort();
+void medirCustoInstrumentacao();
+void compararMotorOrdenacao();
+void listarPorPrefixo();
+void importarComponentes();
+void gerarArquivoImportacao();
 void iniciarMontagem();
 void testarBuscas();
 
@@ -73,6 +320,10 @@ int main() {
     printf("=== SISTEMA DE TORRE DE FUGA - MÓDULO 3 ===\n");
     printf("Sistema Avançado de Organização de Componentes\n\n");
     
+    registrarMetricasTorre();
+    inicializarRadix(&arvoreNomes);
+    publicarVersaoTorre(); // Leitores sempre encontram uma versão publicada
+    
     do {
         exibirMenuPrincipal();
         printf("Escolha uma opção: ");
@@ -93,10 +344,12 @@ int main() {
                     resetarContadores();
                     double tempo = medirTempo(bubbleSortNome, torre, totalComponentes);
                     ordenadoPorNome = 1;
+                    caudaNome = 0;
                     ordenadoPorTipo = 0;
                     ordenadoPorPrioridade = 0;
+                    publicarVersaoTorre();
                     printf("✅ Ordenação concluída!\n");
-                    printf("Comparações: %d | Tempo: %.6f segundos\n", comparacoesBubble, tempo);
+                    printf("Comparações: %llu | Tempo: %.6f segundos\n", lerMetrica(metricaBubble), tempo);
                     mostrarComponentes();
                 }
                 break;
@@ -108,10 +361,12 @@ int main() {
                     resetarContadores();
                     double tempo = medirTempo(insertionSortTipo, torre, totalComponentes);
                     ordenadoPorNome = 0;
+                    caudaNome = 0;
                     ordenadoPorTipo = 1;
                     ordenadoPorPrioridade = 0;
+                    publicarVersaoTorre();
                     printf("✅ Ordenação concluída!\n");
-                    printf("Comparações: %d | Tempo: %.6f segundos\n", comparacoesInsertion, tempo);
+                    printf("Comparações: %llu | Tempo: %.6f segundos\n", lerMetrica(metricaInsertion), tempo);
                     mostrarComponentes();
                 }
                 break;
@@ -123,42 +378,91 @@ int main() {
                     resetarContadores();
                     double tempo = medirTempo(selectionSortPrioridade, torre, totalComponentes);
                     ordenadoPorNome = 0;
+                    caudaNome = 0;
                     ordenadoPorTipo = 0;
                     ordenadoPorPrioridade = 1;
+                    publicarVersaoTorre();
                     printf("✅ Ordenação concluída!\n");
-                    printf("Comparações: %d | Tempo: %.6f segundos\n", comparacoesSelection, tempo);
+                    printf("Comparações: %llu | Tempo: %.6f segundos\n", lerMetrica(metricaSelection), tempo);
                     mostrarComponentes();
                 }
                 break;
             case 5: {
-                if (!ordenadoPorNome) {
+                char nomeBusca[TAMANHO_NOME];
+                
+                // A busca lê a versão publicada, sem bloquear cadastros
+                const VersaoTorre* versao = entrarLeitura();
+                if (!versao->ordenadoPorNome) {
+                    sairLeitura();
                     printf("⚠️  ATENÇÃO: Para busca binária, os componentes devem estar ordenados por nome!\n");
                     printf("Use a opção 2 para ordenar por nome primeiro.\n");
                     break;
                 }
+                sairLeitura();
                 
-                char nomeBusca[TAMANHO_NOME];
                 printf("=== BUSCA DO COMPONENTE-CHAVE ===\n");
                 printf("Digite o nome do componente-chave: ");
-                fgets(nomeBusca, TAMANHO_NOME, stdin);
-                nomeBusca[strcspn(nomeBusca, "\n")] = 0;
+                if (!lerTexto(nomeBusca, TAMANHO_NOME)) {
+                    printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+                    break;
+                }
+                
+                printf("Algoritmo de busca:\n");
+                printf("1. Busca Binária\n");
+                printf("2. Busca por Interpolação\n");
+                printf("3. Busca Exponencial\n");
+                printf("4. Automático\n");
+                printf("Escolha: ");
+                int escolha;
+                scanf("%d", &escolha);
+                limparBuffer();
                 
                 resetarContadores();
+                versao = entrarLeitura();
+                AlgoritmoBusca algoritmo = escolha == 2 ? BUSCA_INTERPOLACAO :
+                                           escolha == 3 ? BUSCA_EXPONENCIAL :
+                                           escolha == 4 ? versao->buscaRecomendada : BUSCA_BINARIA;
+                int comparacoes = 0;
+                int comparacoesCauda = 0;
+                int corpo = versao->total - versao->caudaNome;
                 clock_t inicio = clock();
-                int indice = buscaBinariaPorNome(torre, totalComponentes, nomeBusca);
+                int indice;
+                if (algoritmo == BUSCA_INTERPOLACAO) {
+                    indice = buscaInterpolacaoPorNome(versao->itens, corpo, nomeBusca);
+                    comparacoes = (int)lerMetrica(metricaInterpolacao);
+                } else if (algoritmo == BUSCA_EXPONENCIAL) {
+                    indice = buscaExponencialPorNome(versao->itens, corpo, nomeBusca);
+                    comparacoes = (int)lerMetrica(metricaExponencial);
+                } else {
+                    indice = buscaBinariaPorNome(versao->itens, corpo, nomeBusca);
+                    comparacoes = (int)lerMetrica(metricaBusca);
+                }
+                if (indice == -1 && versao->caudaNome > 0) {
+                    char chave[TAMANHO_NOME];
+                    normalizarTexto(nomeBusca, chave, TAMANHO_NOME);
+                    indice = buscaCaudaContando(versao->itens, versao->total, versao->caudaNome, chave,
+                                                &comparacoesCauda);
+                }
                 clock_t fim = clock();
                 double tempo = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
                 
+                printf("\n🔎 Algoritmo: %s\n", nomeAlgoritmoBusca(algoritmo));
+                
                 if (indice != -1) {
                     printf("🎯 COMPONENTE-CHAVE ENCONTRADO!\n");
-                    printf("Nome: %s\n", torre[indice].nome);
-                    printf("Tipo: %s\n", torre[indice].tipo);
-                    printf("Prioridade: %d\n", torre[indice].prioridade);
+                    printf("Nome: %s\n", versao->itens[indice].nome);
+                    printf("Tipo: %s\n", versao->itens[indice].tipo);
+                    printf("Prioridade: %d\n", versao->itens[indice].prioridade);
                     printf("Posição: %d\n", indice + 1);
                 } else {
                     printf("❌ Componente-chave não encontrado!\n");
                 }
-                printf("Comparações: %d | Tempo: %.6f segundos\n", comparacoesBusca, tempo);
+                sairLeitura();
+                printf("Comparações: %d", comparacoes);
+                if (comparacoesCauda > 0) {
+                    printf(" (+%d na cauda)", comparacoesCauda);
+                }
+                printf(" | Tempo: %.6f segundos\n", tempo);
                 break;
             }
             case 6:
@@ -177,6 +481,130 @@ int main() {
                 testarBuscas();
                 break;
             case 11:
+                if (totalComponentes == 0) {
+                    printf("❌ Nenhum componente cadastrado!\n");
+                } else {
+                    printf("🔄 Ordenando por prioridade (Counting Sort)...\n");
+                    resetarContadores();
+                    double tempo = medirTempo(countingSortPrioridade, torre, totalComponentes);
+                    ordenadoPorNome = 0;
+                    caudaNome = 0;
+                    ordenadoPorTipo = 0;
+                    ordenadoPorPrioridade = 1;
+                    publicarVersaoTorre();
+                    printf("✅ Ordenação concluída!\n");
+                    printf("Comparações: 0 | Operações de contagem: %llu | Tempo: %.6f segundos\n",
+                           lerMetrica(metricaCounting), tempo);
+                    mostrarComponentes();
+                }
+                break;
+            case 12:
+                retirarPorPrioridade();
+                break;
+            case 13:
+                compararArmazenamento();
+                break;
+            case 14:
+                if (totalComponentes == 0) {
+                    printf("❌ Nenhum componente cadastrado!\n");
+                } else {
+                    printf("Número de threads (1-%d) [atual: %d]: ", MAX_THREADS, threadsMergeSort);
+                    int threads;
+                    scanf("%d", &threads);
+                    limparBuffer();
+                    if (threads >= 1 && threads <= MAX_THREADS) {
+                        threadsMergeSort = threads;
+                    } else {
+                        printf("⚠️  Valor inválido, mantendo %d threads.\n", threadsMergeSort);
+                    }
+                    
+                    printf("🔄 Ordenando por nome (Merge Sort paralelo, %d threads)...\n", threadsMergeSort);
+                    resetarContadores();
+                    double inicio = relogioParede();
+                    mergeSortNome(torre, totalComponentes);
+                    double tempo = relogioParede() - inicio;
+                    ordenadoPorNome = 1;
+                    caudaNome = 0;
+                    ordenadoPorTipo = 0;
+                    ordenadoPorPrioridade = 0;
+                    publicarVersaoTorre();
+                    printf("✅ Ordenação concluída!\n");
+                    printf("Comparações: %llu | Tempo: %.6f segundos\n", lerMetrica(metricaMerge), tempo);
+                    mostrarComponentes();
+                }
+                break;
+            case 15:
+                compararAlgoritmosParalelo();
+                break;
+            case 16:
+                testarEscalaMergeSort();
+                break;
+            case 17:
+                simularLeitoresConcorrentes();
+                break;
+            case 18:
+                simularMontagemParalela();
+                break;
+            case 19:
+                exportarMetricas();
+                break;
+            case 20:
+                medirCustoInstrumentacao();
+                break;
+            case 21:
+                compararMotorOrdenacao();
+                break;
+            case 22:
+                listarPorPrefixo();
+                break;
+            case 23:
+                importarComponentes();
+                break;
+            case 24:
+                gerarArquivoImportacao();
+                break;
+            case 25:
+                if (totalComponentes == 0) {
+                    printf("❌ Nenhum componente cadastrado!\n");
+                } else {
+                    printf("🔄 Ordenando por nome (Natural Merge Sort)...\n");
+                    resetarContadores();
+                    double tempo = medirTempo(naturalSortNome, torre, totalComponentes);
+                    ordenadoPorNome = 1;
+                    caudaNome = 0;
+                    ordenadoPorTipo = 0;
+                    ordenadoPorPrioridade = 0;
+                    publicarVersaoTorre();
+                    printf("✅ Ordenação concluída!\n");
+                    printf("Comparações: %llu | Tempo: %.6f segundos\n", lerMetrica(metricaNatural), tempo);
+                    mostrarComponentes();
+                }
+                break;
+            case 26:
+                ordenacaoIncremental = !ordenacaoIncremental;
+                printf("✅ Ordenação incremental %s\n", ordenacaoIncremental ? "ligada" : "desligada");
+                if (ordenacaoIncremental) {
+                    printf("Cadastros fora de ordem vão para uma cauda de até %d componentes,\n", LIMITE_CAUDA);
+                    printf("buscada em sequência e intercalada no corpo ordenado quando enche.\n");
+                } else if (caudaNome > 0) {
+                    intercalarCaudaNome();
+                    publicarVersaoTorre();
+                    printf("🔄 Cauda intercalada: a torre segue ordenada por nome.\n");
+                }
+                break;
+            case 27:
+                buscarNomeAproximado();
+                break;
+            case 28:
+                testarEscalaBuscaAproximada();
+                break;
+            case 29:
+                filtrarComponentes();
+                break;
+            case 30:
+                testarEscalaFiltros();
+                break;
+            case 31:
                 printf("Saindo do sistema... Boa sorte na fuga!\n");
                 break;
             default:
@@ -185,7 +613,7 @@ int main() {
         
         printf("\n");
         
-    } while(opcao != 11);
+    } while(opcao != 31);
     
     return 0;
 }
@@ -199,35 +627,105 @@ void exibirMenuPrincipal() {
     printf("2. Ordenar por nome (Bubble Sort)\n");
     printf("3. Ordenar por tipo (Insertion Sort)\n");
     printf("4. Ordenar por prioridade (Selection Sort)\n");
-    printf("5. Buscar componente-chave (Busca Binária)\n");
+    printf("5. Buscar componente-chave (Binária/Interpolação/Exponencial)\n");
     printf("6. Exibir componentes\n");
     printf("7. Comparar algoritmos\n");
     printf("8. Exibir estatísticas\n");
     printf("9. Iniciar montagem da torre\n");
-    printf("10. Testar buscas (Sequencial vs Binária)\n");
-    printf("11. Sair\n");
+    printf("10. Testar buscas (Sequencial, Binária, Interpolação, Exponencial)\n");
+    printf("11. Ordenar por prioridade (Counting Sort)\n");
+    printf("12. Retirar componentes por prioridade (Fila de Buckets)\n");
+    printf("13. Comparar armazenamento (Linhas vs Colunas)\n");
+    printf("14. Ordenar por nome (Merge Sort paralelo)\n");
+    printf("15. Comparar algoritmos em paralelo\n");
+    printf("16. Teste de escala (Merge Sort paralelo)\n");
+    printf("17. Simular leitores concorrentes\n");
+    printf("18. Simular montagem paralela (grafo de tarefas)\n");
+    printf("19. Exportar métricas (JSON)\n");
+    printf("20. Medir custo da instrumentação\n");
+    printf("21. Comparar motor de ordenação genérico com qsort\n");
+    printf("22. Listar componentes por prefixo (árvore radix)\n");
+    printf("23. Importar componentes (CSV/TSV)\n");
+    printf("24. Gerar arquivo de teste para importação\n");
+    printf("25. Ordenar por nome (Natural Merge Sort, aproveita a ordem existente)\n");
+    printf("26. Ordenação incremental por nome [%s]\n", ordenacaoIncremental ? "ligada" : "desligada");
+    printf("27. Buscar por nome aproximado (erros de digitação)\n");
+    printf("28. Teste de escala (busca aproximada)\n");
+    printf("29. Filtrar componentes (tipo e faixa de prioridade)\n");
+    printf("30. Teste de escala (filtros por coluna)\n");
+    printf("31. Sair\n");
     printf("======================\n");
-    printf("Status: %d/%d componentes | Ordenado: %s\n", 
+    printf("Status: %d/%d componentes | Ordenado: %s", 
            totalComponentes, MAX_COMPONENTES,
            ordenadoPorNome ? "Nome" : (ordenadoPorTipo ? "Tipo" : (ordenadoPorPrioridade ? "Prioridade" : "Não")));
+    if (ordenadoPorNome && caudaNome > 0) {
+        printf(" (+%d na cauda)", caudaNome);
+    }
+    printf("\n");
+}
+
+/*
+ * Calcula as chaves normalizadas de nome e tipo a partir do texto original
+ * Toda criação de componente passa por aqui (ou pelo normalizarTexto direto)
+ */
+void prepararChaves(Componente* c) {
+    normalizarTexto(c->nome, c->chaveNome, TAMANHO_NOME);
+    normalizarTexto(c->tipo, c->chaveTipo, TAMANHO_TIPO);
 }
 
 /*
- * Limpa o buffer de entrada
+ * Registra as métricas do módulo; chamada uma vez, antes de qualquer thread
  */
-void limparBuffer() {
-    int c;
-    while ((c = getchar()) != '\n' && c != EOF);
+void registrarMetricasTorre() {
+    metricaBubble = registrarMetrica("ordenacao.bubble.comparacoes", METRICA_CONTADOR);
+    metricaInsertion = registrarMetrica("ordenacao.insertion.comparacoes", METRICA_CONTADOR);
+    metricaSelection = registrarMetrica("ordenacao.selection.comparacoes", METRICA_CONTADOR);
+    metricaCounting = registrarMetrica("ordenacao.counting.operacoes", METRICA_CONTADOR);
+    metricaMerge = registrarMetrica("ordenacao.merge.comparacoes", METRICA_CONTADOR);
+    metricaNatural = registrarMetrica("ordenacao.natural.comparacoes", METRICA_CONTADOR);
+    metricaHeap = registrarMetrica("montagem.heap.comparacoes", METRICA_CONTADOR);
+    metricaBusca = registrarMetrica("busca.binaria.comparacoes", METRICA_HISTOGRAMA);
+    metricaInterpolacao = registrarMetrica("busca.interpolacao.comparacoes", METRICA_HISTOGRAMA);
+    metricaExponencial = registrarMetrica("busca.exponencial.comparacoes", METRICA_HISTOGRAMA);
+    metricaImportadas = registrarMetrica("importacao.linhas.validas", METRICA_CONTADOR);
+    metricaRejeitadas = registrarMetrica("importacao.linhas.rejeitadas", METRICA_CONTADOR);
 }
 
 /*
  * Reseta todos os contadores de comparações
+ * As fatias das threads não são apagadas: o instante atual vira a referência
  */
 void resetarContadores() {
-    comparacoesBubble = 0;
-    comparacoesInsertion = 0;
-    comparacoesSelection = 0;
-    comparacoesBusca = 0;
+    zerarMetricas();
+}
+
+/*
+ * Exporta todas as métricas acumuladas desde o início do programa em JSON
+ */
+void exportarMetricas() {
+    char caminho[256];
+    printf("Arquivo de saída (vazio para a tela): ");
+    if (fgets(caminho, sizeof(caminho), stdin) == NULL) {
+        return;
+    }
+    caminho[strcspn(caminho, "\n")] = '\0';
+    
+    SnapshotMetricas snapshot;
+    capturarMetricas(&snapshot);
+    
+    if (caminho[0] == '\0') {
+        exportarMetricasJSON(stdout, &snapshot);
+        return;
+    }
+    
+    FILE* arquivo = fopen(caminho, "w");
+    if (arquivo == NULL) {
+        printf("❌ Não foi possível abrir %s\n", caminho);
+        return;
+    }
+    exportarMetricasJSON(arquivo, &snapshot);
+    fclose(arquivo);
+    printf("✅ %d métricas exportadas para %s\n", quantidadeMetricas(), caminho);
 }
 
 
@@ -246,12 +744,18 @@ void cadastrarComponente() {
     
     // Solicita o nome do componente
     printf("Digite o nome do componente: ");
-    fgets(novoComponente.nome, TAMANHO_NOME, stdin);
-    novoComponente.nome[strcspn(novoComponente.nome, "\n")] = 0;
+    if (!lerTexto(novoComponente.nome, TAMANHO_NOME)) {
+        printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+        return;
+    }
+    normalizarTexto(novoComponente.nome, novoComponente.chaveNome, TAMANHO_NOME);
     
-    // Verifica se o componente já existe
-    for (int i = 0; i < totalComponentes; i++) {
-        if (strcmp(torre[i].nome, novoComponente.nome) == 0) {
+    // Verifica se o componente já existe: o filtro descarta nomes novos e só
+    // os demais consultam a árvore radix ("Kit Médico" e "kit medico" são o mesmo)
+    if (consultarBloom(&filtroNomes, novoComponente.chaveNome)) {
+        int existente = buscarRadix(&arvoreNomes, novoComponente.chaveNome) != RADIX_SEM_VALOR;
+        registrarResultadoBloom(&filtroNomes, existente);
+        if (existente) {
             printf("⚠️  Componente '%s' já existe!\n", novoComponente.nome);
             return;
         }
@@ -259,28 +763,50 @@ void cadastrarComponente() {
     
     // Solicita o tipo do componente
     printf("Digite o tipo do componente (controle/suporte/propulsão/outros): ");
-    fgets(novoComponente.tipo, TAMANHO_TIPO, stdin);
-    novoComponente.tipo[strcspn(novoComponente.tipo, "\n")] = 0;
+    if (!lerTexto(novoComponente.tipo, TAMANHO_TIPO)) {
+        printf("❌ ERRO: Tipo muito longo (máximo %d caracteres)!\n", TAMANHO_TIPO - 1);
+        return;
+    }
+    normalizarTexto(novoComponente.tipo, novoComponente.chaveTipo, TAMANHO_TIPO);
     
     // Solicita a prioridade
     do {
-        printf("Digite a prioridade (1-10): ");
+        printf("Digite a prioridade (%d-%d): ", PRIORIDADE_MIN, PRIORIDADE_MAX);
         scanf("%d", &novoComponente.prioridade);
         limparBuffer();
         
-        if (novoComponente.prioridade < 1 || novoComponente.prioridade > 10) {
-            printf("❌ ERRO: Prioridade deve estar entre 1 e 10!\n");
+        if (novoComponente.prioridade < PRIORIDADE_MIN || novoComponente.prioridade > PRIORIDADE_MAX) {
+            printf("❌ ERRO: Prioridade deve estar entre %d e %d!\n", PRIORIDADE_MIN, PRIORIDADE_MAX);
         }
-    } while (novoComponente.prioridade < 1 || novoComponente.prioridade > 10);
+    } while (novoComponente.prioridade < PRIORIDADE_MIN || novoComponente.prioridade > PRIORIDADE_MAX);
     
     // Adiciona o componente ao array
     torre[totalComponentes] = novoComponente;
     totalComponentes++;
+    adicionarColunar(&colunas, &novoComponente);
+    adicionarBloom(&filtroNomes, novoComponente.chaveNome);
+    inserirRadix(&arvoreNomes, novoComponente.chaveNome, colunas.total - 1);
     
-    // Marca como não ordenado
-    ordenadoPorNome = 0;
-    ordenadoPorTipo = 0;
-    ordenadoPorPrioridade = 0;
+    // Continua ordenado só se o novo componente entrou no fim da ordem; no modo
+    // incremental, fora de ordem ele vai para a cauda e a busca binária segue valendo
+    if (totalComponentes > 1) {
+        const Componente* anterior = &torre[totalComponentes - 2];
+        int emOrdem = caudaNome == 0 && strcmp(anterior->chaveNome, novoComponente.chaveNome) <= 0;
+        if (ordenadoPorNome && !emOrdem && ordenacaoIncremental) {
+            caudaNome++;
+        } else {
+            ordenadoPorNome = ordenadoPorNome && emOrdem;
+        }
+        ordenadoPorTipo = ordenadoPorTipo && strcmp(anterior->chaveTipo, novoComponente.chaveTipo) <= 0;
+        ordenadoPorPrioridade = ordenadoPorPrioridade && anterior->prioridade <= novoComponente.prioridade;
+    }
+    if (caudaNome > LIMITE_CAUDA) {
+        printf("🔄 Cauda com %d componentes: intercalando no corpo ordenado...\n", caudaNome);
+        intercalarCaudaNome();
+    }
+    
+    // Leitores passam a ver o novo componente
+    publicarVersaoTorre();
     
     printf("✅ Componente '%s' cadastrado com sucesso!\n", novoComponente.nome);
     mostrarComponentes();
@@ -288,59 +814,80 @@ void cadastrarComponente() {
 
 /*
  * Exibe todos os componentes cadastrados
+ * Lê a versão publicada, então pode rodar em paralelo com cadastros
  */
 void mostrarComponentes() {
     printf("=== COMPONENTES DA TORRE ===\n");
     
-    if (totalComponentes == 0) {
+    const VersaoTorre* versao = entrarLeitura();
+    
+    if (versao->total == 0) {
+        sairLeitura();
         printf("📦 Nenhum componente cadastrado!\n");
         printf("Use a opção 1 para cadastrar componentes.\n");
         return;
     }
     
-    printf("Total: %d/%d componentes\n", totalComponentes, MAX_COMPONENTES);
-    printf("Ordenação atual: %s\n\n", 
-           ordenadoPorNome ? "Por Nome (Bubble Sort)" : 
-           (ordenadoPorTipo ? "Por Tipo (Insertion Sort)" : 
-           (ordenadoPorPrioridade ? "Por Prioridade (Selection Sort)" : "Sem ordenação")));
-    
-    // Cabeçalho da tabela
-    printf("┌─────┬──────────────────────────────┬────────────────────┬────────────┐\n");
-    printf("│ Pos │ Nome                         │ Tipo               │ Prioridade │\n");
-    printf("├─────┼──────────────────────────────┼────────────────────┼────────────┤\n");
+    printf("Total: %d/%d componentes\n", versao->total, MAX_COMPONENTES);
+    printf("Ordenação atual: %s", 
+           versao->ordenadoPorNome ? "Por Nome" : 
+           (versao->ordenadoPorTipo ? "Por Tipo (Insertion Sort)" : 
+           (versao->ordenadoPorPrioridade ? "Por Prioridade" : "Sem ordenação")));
+    if (versao->ordenadoPorNome && versao->caudaNome > 0) {
+        printf(" (+%d no fim, na cauda ainda não intercalada)", versao->caudaNome);
+    }
+    printf("\n\n");
     
     // Lista todos os componentes
-    for (int i = 0; i < totalComponentes; i++) {
-        printf("│ %-3d │ %-28s │ %-18s │ %-10d │\n", 
-               i + 1, 
-               torre[i].nome, 
-               torre[i].tipo, 
-               torre[i].prioridade);
+    imprimirCabecalhoTabela("Pos", "Prioridade");
+    for (int i = 0; i < versao->total; i++) {
+        imprimirLinhaTabela(i + 1, versao->itens[i].nome, versao->itens[i].tipo,
+                            versao->itens[i].prioridade);
     }
+    imprimirRodapeTabela();
     
-    printf("└─────┴──────────────────────────────┴────────────────────┴────────────┘\n");
-    
-    // Estatísticas por tipo
+    // Estatísticas por tipo (calculadas pelo escritor ao publicar a versão)
     printf("\n=== ESTATÍSTICAS POR TIPO ===\n");
-    int contadores[4] = {0}; // controle, suporte, propulsão, outros
+    printf("🎛️  Controle: %d componentes\n", versao->categorias[CATEGORIA_CONTROLE]);
+    printf("🔧 Suporte: %d componentes\n", versao->categorias[CATEGORIA_SUPORTE]);
+    printf("🚀 Propulsão: %d componentes\n", versao->categorias[CATEGORIA_PROPULSAO]);
+    printf("⚙️  Outros: %d componentes\n", versao->categorias[CATEGORIA_OUTROS]);
     
-    for (int i = 0; i < totalComponentes; i++) {
-        if (strstr(torre[i].tipo, "controle") != NULL) {
-            contadores[0]++;
-        } else if (strstr(torre[i].tipo, "suporte") != NULL) {
-            contadores[1]++;
-        } else if (strstr(torre[i].tipo, "propulsão") != NULL || 
-                   strstr(torre[i].tipo, "propulsao") != NULL) {
-            contadores[2]++;
-        } else {
-            contadores[3]++;
-        }
+    sairLeitura();
+}
+
+// Linha da tabela para cada chave visitada na árvore radix (exibe o nome original)
+static void exibirComponenteRadix(const char* chave, int posicao, void* contexto) {
+    int* ordem = (int*)contexto;
+    (void)chave;
+    imprimirLinhaTabela(++(*ordem), nomeColunar(&colunas, posicao), tipoColunar(&colunas, posicao),
+                        prioridadeColunar(&colunas, posicao));
+}
+
+/*
+ * Lista em ordem alfabética os componentes cujo nome começa com um prefixo
+ * A ordem vem da árvore radix: torre não é ordenada
+ */
+void listarPorPrefixo() {
+    char prefixo[TAMANHO_NOME];
+    char chavePrefixo[TAMANHO_NOME];
+    
+    printf("=== COMPONENTES POR PREFIXO ===\n");
+    printf("Prefixo do nome (vazio para todos): ");
+    if (!lerTexto(prefixo, TAMANHO_NOME)) {
+        printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+        return;
     }
+    normalizarTexto(prefixo, chavePrefixo, TAMANHO_NOME);
+    
+    printf("\n");
+    imprimirCabecalhoTabela("Nº", "Prioridade");
+    int ordem = 0;
+    int encontrados = percorrerRadix(&arvoreNomes, chavePrefixo, exibirComponenteRadix, &ordem);
+    imprimirRodapeTabela();
     
-    printf("🎛️  Controle: %d componentes\n", contadores[0]);
-    printf("🔧 Suporte: %d componentes\n", contadores[1]);
-    printf("🚀 Propulsão: %d componentes\n", contadores[2]);
-    printf("⚙️  Outros: %d componentes\n", contadores[3]);
+    printf("🔤 %d componente(s) começando com \"%s\"\n", encontrados, prefixo);
+    printf("🌳 Árvore radix: %d nomes em %d nós\n", arvoreNomes.chaves, arvoreNomes.nos);
 }
 
 /*
@@ -350,21 +897,72 @@ void exibirEstatisticas() {
     printf("=== ESTATÍSTICAS DE DESEMPENHO ===\n");
     printf("Total de componentes: %d/%d\n", totalComponentes, MAX_COMPONENTES);
     printf("\n📊 COMPARAÇÕES POR ALGORITMO:\n");
-    printf("├─ Bubble Sort (Nome): %d comparações\n", comparacoesBubble);
-    printf("├─ Insertion Sort (Tipo): %d comparações\n", comparacoesInsertion);
-    printf("├─ Selection Sort (Prioridade): %d comparações\n", comparacoesSelection);
-    printf("└─ Busca Binária: %d comparações\n", comparacoesBusca);
+    if (!INSTRUMENTACAO) {
+        printf("⚠️  Compilado com INSTRUMENTACAO=0: as contagens ficam zeradas\n");
+    }
+    printf("├─ Bubble Sort (Nome): %llu comparações\n", lerMetrica(metricaBubble));
+    printf("├─ Insertion Sort (Tipo): %llu comparações\n", lerMetrica(metricaInsertion));
+    printf("├─ Selection Sort (Prioridade): %llu comparações\n", lerMetrica(metricaSelection));
+    printf("├─ Counting Sort (Prioridade): 0 comparações (%llu operações de contagem)\n", lerMetrica(metricaCounting));
+    printf("├─ Merge Sort paralelo (Nome): %llu comparações\n", lerMetrica(metricaMerge));
+    printf("├─ Natural Merge Sort (Nome): %llu comparações\n", lerMetrica(metricaNatural));
+    printf("├─ Heap de montagem (Prioridade): %llu comparações\n", lerMetrica(metricaHeap));
+    printf("├─ Busca Binária: %llu comparações\n", lerMetrica(metricaBusca));
+    printf("├─ Busca por Interpolação: %llu comparações\n", lerMetrica(metricaInterpolacao));
+    printf("└─ Busca Exponencial: %llu comparações\n", lerMetrica(metricaExponencial));
+    
+    // Histogramas acumulados desde o início do programa
+    SnapshotMetricas snapshot;
+    capturarMetricas(&snapshot);
+    int buscas[] = {metricaBusca, metricaInterpolacao, metricaExponencial};
+    const char* nomesBuscas[] = {"Binária", "Interpolação", "Exponencial"};
+    printf("\n🔬 COMPARAÇÕES POR BUSCA (desde o início):\n");
+    for (int i = 0; i < 3; i++) {
+        unsigned long long amostras = amostrasHistograma(&snapshot, buscas[i]);
+        int maiorBalde = 0;
+        for (int b = 0; b < BALDES_HISTOGRAMA; b++) {
+            if (snapshot.baldes[buscas[i]][b] > 0) {
+                maiorBalde = b;
+            }
+        }
+        printf("%s %s: %llu buscas, média %.1f, máximo < %d\n", i == 2 ? "└─" : "├─",
+               nomesBuscas[i], amostras,
+               amostras > 0 ? (double)snapshot.valores[buscas[i]] / amostras : 0.0,
+               1 << maiorBalde);
+    }
     
     printf("\n🎯 STATUS DE ORDENAÇÃO:\n");
     printf("├─ Ordenado por Nome: %s\n", ordenadoPorNome ? "✅ Sim" : "❌ Não");
+    printf("├─ Ordenação incremental: %s | Cauda: %d/%d | Intercalações: %d\n",
+           ordenacaoIncremental ? "ligada" : "desligada", ordenadoPorNome ? caudaNome : 0, LIMITE_CAUDA,
+           intercalacoesCauda);
     printf("├─ Ordenado por Tipo: %s\n", ordenadoPorTipo ? "✅ Sim" : "❌ Não");
     printf("└─ Ordenado por Prioridade: %s\n", ordenadoPorPrioridade ? "✅ Sim" : "❌ Não");
     
+    printf("\n🧮 FILTRO DE BLOOM (NOMES):\n");
+    printf("├─ Bits ligados: %d/%d\n", bitsLigadosBloom(&filtroNomes), BLOOM_BLOCOS * 512);
+    printf("├─ Consultas: %d | Descartadas sem busca: %d\n", filtroNomes.consultas, filtroNomes.rejeitadas);
+    printf("└─ Falsos positivos: %d (%.2f%% dos nomes ausentes)\n", filtroNomes.falsosPositivos,
+           taxaFalsosPositivosBloom(&filtroNomes));
+    
+    printf("\n📈 DISTRIBUIÇÃO POR PRIORIDADE:\n");
+    int histograma[TOTAL_PRIORIDADES];
+    histogramaPrioridades(&colunas, histograma);
+    for (int p = PRIORIDADE_MAX; p >= PRIORIDADE_MIN; p--) {
+        printf("%s Prioridade %2d: %d componentes\n",
+               p == PRIORIDADE_MIN ? "└─" : "├─", p, histograma[p - PRIORIDADE_MIN]);
+    }
+    
     printf("\n⚡ COMPLEXIDADE DOS ALGORITMOS:\n");
     printf("├─ Bubble Sort: O(n²) - Quadrática\n");
     printf("├─ Insertion Sort: O(n²) pior caso, O(n) melhor caso\n");
     printf("├─ Selection Sort: O(n²) - Quadrática\n");
-    printf("└─ Busca Binária: O(log n) - Logarítmica\n");
+    printf("├─ Counting Sort: O(n + 10) - Linear (prioridades 1 a 10)\n");
+    printf("├─ Merge Sort paralelo: O(n log n), dividido entre as threads\n");
+    printf("├─ Heap de montagem: O(n) para construir, O(log n) por retirada\n");
+    printf("├─ Busca Binária: O(log n) - Logarítmica\n");
+    printf("├─ Busca por Interpolação: O(log log n) com nomes uniformes, O(n) no pior caso\n");
+    printf("└─ Busca Exponencial: O(log i), i = posição do componente\n");
     
     printf("==================================\n");
 }
@@ -372,406 +970,3426 @@ void exibirEstatisticas() {
 
 /*
  * ========================================
- * ALGORITMOS DE ORDENAÇÃO
+ * HEAP DE MONTAGEM POR PRIORIDADE
  * ========================================
  */
 
 /*
- * Bubble Sort - Ordenação por nome (alfabética)
- * Complexidade: O(n²)
- * Compara elementos adjacentes e os troca se estiverem fora de ordem
+ * Retorna 1 se a entrada a deve sair do heap antes da entrada b
  */
-void bubbleSortNome(Componente arr[], int n) {
-    for (int i = 0; i < n - 1; i++) {
-        int trocou = 0; // Flag para otimização
-        
-        for (int j = 0; j < n - i - 1; j++) {
-            comparacoesBubble++; // Conta cada comparação
-            
-            if (strcmp(arr[j].nome, arr[j + 1].nome) > 0) {
-                // Troca os elementos
-                Componente temp = arr[j];
-                arr[j] = arr[j + 1];
-                arr[j + 1] = temp;
-                trocou = 1;
-            }
-        }
-        
-        // Se não houve trocas, o array já está ordenado
-        if (!trocou) {
-            break;
-        }
+static int saiAntes(const EntradaHeap* a, const EntradaHeap* b) {
+    CONTAR(metricaHeap); // Conta cada comparação
+    if (a->prioridade != b->prioridade) {
+        return a->prioridade > b->prioridade;
     }
+    return a->indice < b->indice;
 }
 
 /*
- * Insertion Sort - Ordenação por tipo (alfabética)
- * Complexidade: O(n²) no pior caso, O(n) no melhor caso
- * Insere cada elemento na posição correta em relação aos elementos já ordenados
+ * Desce a entrada da posição i até que nenhum filho deva sair antes dela
  */
-void insertionSortTipo(Componente arr[], int n) {
-    for (int i = 1; i < n; i++) {
-        Componente chave = arr[i];
-        int j = i - 1;
-        
-        // Move elementos maiores que a chave uma posição à frente
-        while (j >= 0) {
-            comparacoesInsertion++; // Conta cada comparação
-            
-            if (strcmp(arr[j].tipo, chave.tipo) > 0) {
-                arr[j + 1] = arr[j];
-                j--;
-            } else {
-                break;
-            }
+static void descerHeap(HeapMontagem* heap, int i) {
+    EntradaHeap entrada = heap->itens[i];
+    
+    while (1) {
+        int primeiroFilho = ARIDADE_HEAP * i + 1;
+        if (primeiroFilho >= heap->total) {
+            break;
         }
         
-        arr[j + 1] = chave;
-    }
-}
-
-/*
- * Selection Sort - Ordenação por prioridade (numérica)
- * Complexidade: O(n²)
- * Encontra o menor elemento e o coloca na posição correta
- */
-void selectionSortPrioridade(Componente arr[], int n) {
-    for (int i = 0; i < n - 1; i++) {
-        int indiceMenor = i;
-        
-        // Encontra o elemento com menor prioridade
-        for (int j = i + 1; j < n; j++) {
-            comparacoesSelection++; // Conta cada comparação
-            
-            if (arr[j].prioridade < arr[indiceMenor].prioridade) {
-                indiceMenor = j;
+        // Escolhe o filho que deve sair primeiro
+        int ultimoFilho = primeiroFilho + ARIDADE_HEAP;
+        if (ultimoFilho > heap->total) {
+            ultimoFilho = heap->total;
+        }
+        int melhor = primeiroFilho;
+        for (int f = primeiroFilho + 1; f < ultimoFilho; f++) {
+            if (saiAntes(&heap->itens[f], &heap->itens[melhor])) {
+                melhor = f;
             }
         }
         
-        // Troca o elemento atual com o menor encontrado
-        if (indiceMenor != i) {
-            Componente temp = arr[i];
-            arr[i] = arr[indiceMenor];
-            arr[indiceMenor] = temp;
+        if (!saiAntes(&heap->itens[melhor], &entrada)) {
+            break;
         }
+        heap->itens[i] = heap->itens[melhor];
+        i = melhor;
     }
+    
+    heap->itens[i] = entrada;
 }
 
 /*
- * Função para medir tempo de execução de algoritmos de ordenação
+ * Monta o heap com todos os componentes de uma vez
+ * Complexidade: O(n), descendo cada nó interno a partir do último
  */
-double medirTempo(void (*algoritmo)(Componente[], int), Componente arr[], int n) {
-    // Cria uma cópia do array para não afetar o original durante a medição
-    Componente copia[MAX_COMPONENTES];
+void construirHeapMontagem(HeapMontagem* heap, const Componente arr[], int n) {
+    heap->total = n;
     for (int i = 0; i < n; i++) {
-        copia[i] = arr[i];
+        heap->itens[i].prioridade = arr[i].prioridade;
+        heap->itens[i].indice = i;
     }
     
-    clock_t inicio = clock();
-    algoritmo(copia, n); // Executa o algoritmo na cópia
-    clock_t fim = clock();
-    
-    // Copia o resultado de volta para o array original
-    for (int i = 0; i < n; i++) {
-        arr[i] = copia[i];
+    for (int i = (n - 2) / ARIDADE_HEAP; i >= 0 && n > 1; i--) {
+        descerHeap(heap, i);
     }
-    
-    return ((double)(fim - inicio)) / CLOCKS_PER_SEC;
 }
 
 /*
- * Função para comparar todos os algoritmos de ordenação
+ * Retira o componente de maior prioridade
+ * Complexidade: O(log n)
+ * Retorna a posição do componente em torre ou -1 se o heap estiver vazio
  */
-void compararAlgoritmos() {
-    if (totalComponentes < 2) {
-        printf("❌ É necessário ter pelo menos 2 componentes para comparar algoritmos!\n");
-        return;
+int retirarHeapMontagem(HeapMontagem* heap) {
+    if (heap->total == 0) {
+        return -1;
     }
     
-    printf("=== COMPARAÇÃO DE ALGORITMOS DE ORDENAÇÃO ===\n");
-    printf("Testando com %d componentes...\n\n", totalComponentes);
-    
-    // Salva o estado original
-    Componente original[MAX_COMPONENTES];
-    for (int i = 0; i < totalComponentes; i++) {
-        original[i] = torre[i];
+    int indice = heap->itens[0].indice;
+    heap->total--;
+    if (heap->total > 0) {
+        heap->itens[0] = heap->itens[heap->total];
+        descerHeap(heap, 0);
     }
     
-    // Testa Bubble Sort
-    printf("🔵 BUBBLE SORT (por nome):\n");
-    resetarContadores();
-    double tempoBubble = medirTempo(bubbleSortNome, torre, totalComponentes);
-    printf("├─ Comparações: %d\n", comparacoesBubble);
-    printf("└─ Tempo: %.6f segundos\n\n", tempoBubble);
+    return indice;
+}
+
+/*
+ * ========================================
+ * ARMAZENAMENTO COLUNAR
+ * ========================================
+ */
+
+/*
+ * Classifica o texto do tipo em uma das categorias conhecidas
+ * Chamada uma única vez por tipo distinto, ao entrar no dicionário
+ * A comparação usa a chave normalizada: "Propulsão", "PROPULSAO" e
+ * "propulsão" caem todos na mesma categoria
+ */
+CategoriaTipo classificarTipo(const char* tipo) {
+    char chave[TAMANHO_TIPO];
+    normalizarTexto(tipo, chave, TAMANHO_TIPO);
     
-    // Restaura estado original
-    for (int i = 0; i < totalComponentes; i++) {
-        torre[i] = original[i];
+    if (strstr(chave, "controle") != NULL) {
+        return CATEGORIA_CONTROLE;
+    } else if (strstr(chave, "suporte") != NULL) {
+        return CATEGORIA_SUPORTE;
+    } else if (strstr(chave, "propulsao") != NULL) {
+        return CATEGORIA_PROPULSAO;
     }
+    return CATEGORIA_OUTROS;
+}
+
+/*
+ * Sistemas essenciais que o tipo atende, um bit por categoria (1 << CATEGORIA_...)
+ * Ao contrário de classificarTipo, os testes são independentes:
+ * "controle/suporte" atende aos dois sistemas na verificação da montagem
+ */
+int sistemasDoTipo(const char* tipo) {
+    char chave[TAMANHO_TIPO];
+    normalizarTexto(tipo, chave, TAMANHO_TIPO);
     
-    // Testa Insertion Sort
-    printf("🟢 INSERTION SORT (por tipo):\n");
-    resetarContadores();
-    double tempoInsertion = medirTempo(insertionSortTipo, torre, totalComponentes);
-    printf("├─ Comparações: %d\n", comparacoesInsertion);
-    printf("└─ Tempo: %.6f segundos\n\n", tempoInsertion);
-    
-    // Restaura estado original
-    for (int i = 0; i < totalComponentes; i++) {
-        torre[i] = original[i];
+    int sistemas = 0;
+    if (strstr(chave, "controle") != NULL) {
+        sistemas |= 1 << CATEGORIA_CONTROLE;
     }
-    
+    if (strstr(chave, "suporte") != NULL) {
+        sistemas |= 1 << CATEGORIA_SUPORTE;
+    }
+    if (strstr(chave, "propulsao") != NULL) {
+        sistemas |= 1 << CATEGORIA_PROPULSAO;
+    }
+    return sistemas;
+}
+
+/*
+ * Acrescenta um componente ao final das colunas
+ * O tipo é trocado pelo seu índice no dicionário de tipos distintos
+ */
+void adicionarColunar(TorreColunar* tc, const Componente* c) {
+    int id = -1;
+    for (int t = 0; t < tc->totalTipos; t++) {
+        if (strcmp(tc->dicionarioTipos[t], c->tipo) == 0) {
+            id = t;
+            break;
+        }
+    }
+    
+    if (id == -1) {
+        id = tc->totalTipos++;
+        strcpy(tc->dicionarioTipos[id], c->tipo);
+        tc->categoriaTipo[id] = (unsigned char)classificarTipo(c->tipo);
+        tc->sistemasTipo[id] = (unsigned char)sistemasDoTipo(c->tipo);
+    }
+    
+    strcpy(tc->nomes[tc->total], c->nome);
+    tc->tipoIds[tc->total] = (unsigned char)id;
+    tc->prioridades[tc->total] = (unsigned char)c->prioridade;
+    tc->total++;
+}
+
+/*
+ * Acessores de um campo do i-ésimo componente cadastrado
+ */
+const char* nomeColunar(const TorreColunar* tc, int i) {
+    return tc->nomes[i];
+}
+
+const char* tipoColunar(const TorreColunar* tc, int i) {
+    return tc->dicionarioTipos[tc->tipoIds[i]];
+}
+
+int prioridadeColunar(const TorreColunar* tc, int i) {
+    return tc->prioridades[i];
+}
+
+/*
+ * Remonta o i-ésimo componente a partir das colunas
+ */
+Componente obterComponenteColunar(const TorreColunar* tc, int i) {
+    Componente c;
+    strcpy(c.nome, nomeColunar(tc, i));
+    strcpy(c.tipo, tipoColunar(tc, i));
+    c.prioridade = prioridadeColunar(tc, i);
+    prepararChaves(&c);
+    return c;
+}
+
+/*
+ * Conta quantos componentes há em cada prioridade
+ * Lê apenas a coluna de prioridades (1 byte por componente)
+ */
+void histogramaPrioridades(const TorreColunar* tc, int histograma[]) {
+    for (int p = 0; p < TOTAL_PRIORIDADES; p++) {
+        histograma[p] = 0;
+    }
+    for (int i = 0; i < tc->total; i++) {
+        histograma[tc->prioridades[i] - PRIORIDADE_MIN]++;
+    }
+}
+
+/*
+ * Conta os componentes com prioridade >= minimo
+ * Laço sem desvios sobre bytes contíguos: o compilador consegue vetorizar
+ */
+int contarPrioridadeMinima(const TorreColunar* tc, int minimo) {
+    const unsigned char* prioridades = tc->prioridades;
+    int n = tc->total;
+    int total = 0;
+    
+    for (int i = 0; i < n; i++) {
+        total += prioridades[i] >= minimo;
+    }
+    return total;
+}
+
+/*
+ * Seleciona os componentes cujo tipo normalizado é chaveTipo
+ * Grafias diferentes do mesmo tipo ("Propulsão", "propulsao") são entradas
+ * distintas do dicionário: cada uma vira uma varredura da coluna de ids
+ * Retorna quantos tipos do dicionário casaram
+ */
+int selecionarTipoColunar(const TorreColunar* tc, const char* chaveTipo, unsigned long long selecao[]) {
+    unsigned long long porTipo[PALAVRAS_SELECAO(MAX_COMPONENTES)];
+    int casados = 0;
+    
+    memset(selecao, 0, (size_t)PALAVRAS_SELECAO(tc->total) * sizeof(unsigned long long));
+    for (int t = 0; t < tc->totalTipos; t++) {
+        char chave[TAMANHO_TIPO];
+        normalizarTexto(tc->dicionarioTipos[t], chave, TAMANHO_TIPO);
+        if (strcmp(chave, chaveTipo) == 0) {
+            selecionarIgualByte(tc->tipoIds, tc->total, (unsigned char)t, porTipo);
+            unirSelecao(selecao, porTipo, tc->total);
+            casados++;
+        }
+    }
+    return casados;
+}
+
+/*
+ * Sistemas atendidos por algum componente cadastrado (união de sistemasDoTipo)
+ * Todo tipo do dicionário tem ao menos um componente: as colunas só crescem
+ */
+int sistemasPresentes(const TorreColunar* tc) {
+    int sistemas = 0;
+    for (int t = 0; t < tc->totalTipos; t++) {
+        sistemas |= tc->sistemasTipo[t];
+    }
+    return sistemas;
+}
+
+/*
+ * Conta os componentes de cada categoria
+ * Primeiro conta por tipo distinto (1 byte por componente) e só depois
+ * converte cada tipo na sua categoria, sem nenhum strstr por componente
+ */
+void contarCategorias(const TorreColunar* tc, int contadores[]) {
+    int porTipo[MAX_COMPONENTES] = {0};
+    
+    for (int i = 0; i < tc->total; i++) {
+        porTipo[tc->tipoIds[i]]++;
+    }
+    
+    for (int c = 0; c < TOTAL_CATEGORIAS; c++) {
+        contadores[c] = 0;
+    }
+    for (int t = 0; t < tc->totalTipos; t++) {
+        contadores[tc->categoriaTipo[t]] += porTipo[t];
+    }
+}
+
+/*
+ * Compara varreduras por prioridade e por tipo no vetor de structs (linhas)
+ * e no armazenamento colunar
+ */
+void compararArmazenamento() {
+    if (totalComponentes == 0) {
+        printf("❌ Nenhum componente cadastrado para comparar!\n");
+        return;
+    }
+    
+    const int repeticoes = 100000;
+    volatile int resultado = 0; // Impede que o compilador descarte as varreduras
+    int minimo = (PRIORIDADE_MIN + PRIORIDADE_MAX) / 2;
+    
+    printf("=== COMPARAÇÃO DE ARMAZENAMENTO: LINHAS vs COLUNAS ===\n");
+    printf("Testando com %d componentes, %d repetições por varredura...\n\n",
+           totalComponentes, repeticoes);
+    
+    // Varredura por prioridade nas linhas
+    clock_t inicio = clock();
+    for (int r = 0; r < repeticoes; r++) {
+        int total = 0;
+        for (int i = 0; i < totalComponentes; i++) {
+            total += torre[i].prioridade >= minimo;
+        }
+        resultado += total;
+    }
+    double tempoPrioridadeLinhas = ((double)(clock() - inicio)) / CLOCKS_PER_SEC;
+    
+    // Varredura por prioridade nas colunas
+    inicio = clock();
+    for (int r = 0; r < repeticoes; r++) {
+        resultado += contarPrioridadeMinima(&colunas, minimo);
+    }
+    double tempoPrioridadeColunas = ((double)(clock() - inicio)) / CLOCKS_PER_SEC;
+    
+    // Contagem por categoria nas linhas
+    inicio = clock();
+    for (int r = 0; r < repeticoes; r++) {
+        int contadores[TOTAL_CATEGORIAS] = {0};
+        for (int i = 0; i < totalComponentes; i++) {
+            contadores[classificarTipo(torre[i].tipo)]++;
+        }
+        resultado += contadores[CATEGORIA_CONTROLE];
+    }
+    double tempoTipoLinhas = ((double)(clock() - inicio)) / CLOCKS_PER_SEC;
+    
+    // Contagem por categoria nas colunas
+    inicio = clock();
+    for (int r = 0; r < repeticoes; r++) {
+        int contadores[TOTAL_CATEGORIAS];
+        contarCategorias(&colunas, contadores);
+        resultado += contadores[CATEGORIA_CONTROLE];
+    }
+    double tempoTipoColunas = ((double)(clock() - inicio)) / CLOCKS_PER_SEC;
+    
+    printf("🔢 PRIORIDADE >= %d:\n", minimo);
+    printf("├─ Linhas: %.6f segundos (%d bytes lidos por componente)\n",
+           tempoPrioridadeLinhas, (int)sizeof(Componente));
+    printf("└─ Colunas: %.6f segundos (%d byte lido por componente)\n\n",
+           tempoPrioridadeColunas, (int)sizeof(colunas.prioridades[0]));
+    
+    printf("🏷️  CONTAGEM POR CATEGORIA:\n");
+    printf("├─ Linhas: %.6f segundos (strstr por componente)\n", tempoTipoLinhas);
+    printf("└─ Colunas: %.6f segundos (%d tipos distintos classificados no cadastro)\n\n",
+           tempoTipoColunas, colunas.totalTipos);
+    
+    printf("📊 ANÁLISE COMPARATIVA:\n");
+    printf("├─ Speedup por prioridade: %.1fx\n",
+           tempoPrioridadeColunas > 0 ? tempoPrioridadeLinhas / tempoPrioridadeColunas : 1.0);
+    printf("└─ Speedup por categoria: %.1fx\n",
+           tempoTipoColunas > 0 ? tempoTipoLinhas / tempoTipoColunas : 1.0);
+    
+    printf("=============================================\n");
+}
+
+/*
+ * ========================================
+ * ALGORITMOS DE ORDENAÇÃO
+ * ========================================
+ */
+
+// Ordenações especializadas por chave, geradas pelo motor genérico (ordenacao.h)
+#define MENOR_NOME(a, b) (strcmp((a)->chaveNome, (b)->chaveNome) < 0)
+#define MENOR_TIPO(a, b) (strcmp((a)->chaveTipo, (b)->chaveTipo) < 0)
+#define MENOR_PRIORIDADE(a, b) ((a)->prioridade < (b)->prioridade)
+
+DEFINIR_ORDENACOES(Nome, Componente, MENOR_NOME)
+DEFINIR_ORDENACOES(Tipo, Componente, MENOR_TIPO)
+DEFINIR_ORDENACOES(Prioridade, Componente, MENOR_PRIORIDADE)
+
+// Mesma chave de nome, contando cada comparação para o menu e as estatísticas
+#define MENOR_NOME_CONTANDO(a, b) (CONTAR(metricaNatural), MENOR_NOME(a, b))
+
+DEFINIR_ORDENACOES(NomeContando, Componente, MENOR_NOME_CONTANDO)
+
+/*
+ * Bubble Sort - Ordenação por nome (alfabética)
+ * Complexidade: O(n²)
+ * Compara elementos adjacentes e os troca se estiverem fora de ordem
+ */
+void bubbleSortNome(Componente arr[], int n) {
+    for (int i = 0; i < n - 1; i++) {
+        int trocou = 0; // Flag para otimização
+        
+        for (int j = 0; j < n - i - 1; j++) {
+            CONTAR(metricaBubble); // Conta cada comparação
+            
+            if (strcmp(arr[j].chaveNome, arr[j + 1].chaveNome) > 0) {
+                // Troca os elementos
+                Componente temp = arr[j];
+                arr[j] = arr[j + 1];
+                arr[j + 1] = temp;
+                trocou = 1;
+            }
+        }
+        
+        // Se não houve trocas, o array já está ordenado
+        if (!trocou) {
+            break;
+        }
+    }
+}
+
+/*
+ * Insertion Sort - Ordenação por tipo (alfabética)
+ * Complexidade: O(n²) no pior caso, O(n) no melhor caso
+ * Insere cada elemento na posição correta em relação aos elementos já ordenados
+ */
+void insertionSortTipo(Componente arr[], int n) {
+    for (int i = 1; i < n; i++) {
+        Componente chave = arr[i];
+        int j = i - 1;
+        
+        // Move elementos maiores que a chave uma posição à frente
+        while (j >= 0) {
+            CONTAR(metricaInsertion); // Conta cada comparação
+            
+            if (strcmp(arr[j].chaveTipo, chave.chaveTipo) > 0) {
+                arr[j + 1] = arr[j];
+                j--;
+            } else {
+                break;
+            }
+        }
+        
+        arr[j + 1] = chave;
+    }
+}
+
+/*
+ * Selection Sort - Ordenação por prioridade (numérica)
+ * Complexidade: O(n²)
+ * Encontra o menor elemento e o coloca na posição correta
+ */
+void selectionSortPrioridade(Componente arr[], int n) {
+    for (int i = 0; i < n - 1; i++) {
+        int indiceMenor = i;
+        
+        // Encontra o elemento com menor prioridade
+        for (int j = i + 1; j < n; j++) {
+            CONTAR(metricaSelection); // Conta cada comparação
+            
+            if (arr[j].prioridade < arr[indiceMenor].prioridade) {
+                indiceMenor = j;
+            }
+        }
+        
+        // Troca o elemento atual com o menor encontrado
+        if (indiceMenor != i) {
+            Componente temp = arr[i];
+            arr[i] = arr[indiceMenor];
+            arr[indiceMenor] = temp;
+        }
+    }
+}
+
+/*
+ * Counting Sort - Ordenação estável por prioridade (numérica)
+ * Complexidade: O(n + 10)
+ * Como a prioridade só assume valores de 1 a 10, conta quantos componentes
+ * há em cada prioridade e distribui cada um direto na posição final,
+ * sem nenhuma comparação entre elementos
+ */
+void countingSortPrioridade(Componente arr[], int n) {
+    if (n <= 1) {
+        return;
+    }
+    
+    Componente* saida = (Componente*)malloc(n * sizeof(Componente));
+    if (saida == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return;
+    }
+    
+    int posicoes[TOTAL_PRIORIDADES] = {0};
+    
+    // Conta quantos componentes existem em cada prioridade
+    for (int i = 0; i < n; i++) {
+        CONTAR(metricaCounting); // Conta cada acesso à chave
+        posicoes[arr[i].prioridade - PRIORIDADE_MIN]++;
+    }
+    
+    // Converte as contagens na posição inicial de cada prioridade
+    int soma = 0;
+    for (int p = 0; p < TOTAL_PRIORIDADES; p++) {
+        int quantidade = posicoes[p];
+        posicoes[p] = soma;
+        soma += quantidade;
+    }
+    
+    // Distribui na ordem original para manter a estabilidade
+    for (int i = 0; i < n; i++) {
+        saida[posicoes[arr[i].prioridade - PRIORIDADE_MIN]++] = arr[i];
+    }
+    
+    for (int i = 0; i < n; i++) {
+        arr[i] = saida[i];
+    }
+    
+    free(saida);
+}
+
+/*
+ * Natural Merge Sort - Ordenação por nome (alfabética)
+ * Complexidade: O(n log n) no pior caso, O(n) em dados quase ordenados
+ * Intercala os trechos que já estão em ordem: depois de alguns cadastros no
+ * fim de uma torre ordenada, reordenar custa pouco mais que percorrê-la
+ */
+void naturalSortNome(Componente arr[], int n) {
+    ordenarNaturalNomeContando(arr, n);
+}
+
+/*
+ * Intercala a cauda de cadastros no corpo ordenado por nome
+ * O Natural Merge Sort reconhece o corpo como um único trecho: o custo é o de
+ * ordenar os poucos itens da cauda e uma intercalação, não o de reordenar tudo
+ * Quem chama publica a nova versão
+ */
+void intercalarCaudaNome() {
+    if (!ordenadoPorNome || caudaNome == 0) {
+        return;
+    }
+    naturalSortNome(torre, totalComponentes);
+    caudaNome = 0;
+    ordenadoPorTipo = 0;
+    ordenadoPorPrioridade = 0;
+    intercalacoesCauda++;
+}
+
+/*
+ * ========================================
+ * MERGE SORT PARALELO
+ * ========================================
+ */
+
+// Trecho de trabalho de uma thread do Merge Sort
+typedef struct {
+    Componente* arr;
+    Componente* aux;
+    int inicio;       // Primeira posição do trecho
+    int meio;         // Início da segunda metade (usado na intercalação)
+    int fim;          // Uma posição após o fim do trecho
+    int comparacoes;  // Contador próprio da thread, somado ao final
+} TrechoMerge;
+
+/*
+ * Intercala arr[inicio..meio) e arr[meio..fim), já ordenados por nome
+ * Em caso de empate, o elemento da esquerda vem primeiro (estável)
+ */
+static void intercalarNome(Componente arr[], Componente aux[], int inicio, int meio, int fim,
+                           int* comparacoes) {
+    int i = inicio, j = meio, k = inicio;
+    
+    while (i < meio && j < fim) {
+        CONTAR_LOCAL(*comparacoes);
+        if (strcmp(arr[j].chaveNome, arr[i].chaveNome) < 0) {
+            aux[k++] = arr[j++];
+        } else {
+            aux[k++] = arr[i++];
+        }
+    }
+    while (i < meio) {
+        aux[k++] = arr[i++];
+    }
+    while (j < fim) {
+        aux[k++] = arr[j++];
+    }
+    
+    memcpy(&arr[inicio], &aux[inicio], (fim - inicio) * sizeof(Componente));
+}
+
+/*
+ * Merge Sort sequencial de arr[inicio..fim)
+ */
+static void mergeSortIntervalo(Componente arr[], Componente aux[], int inicio, int fim,
+                               int* comparacoes) {
+    if (fim - inicio < 2) {
+        return;
+    }
+    
+    int meio = inicio + (fim - inicio) / 2;
+    mergeSortIntervalo(arr, aux, inicio, meio, comparacoes);
+    mergeSortIntervalo(arr, aux, meio, fim, comparacoes);
+    intercalarNome(arr, aux, inicio, meio, fim, comparacoes);
+}
+
+static void* ordenarTrecho(void* arg) {
+    TrechoMerge* t = (TrechoMerge*)arg;
+    mergeSortIntervalo(t->arr, t->aux, t->inicio, t->fim, &t->comparacoes);
+    SOMAR(metricaMerge, t->comparacoes);
+    return NULL;
+}
+
+static void* intercalarTrecho(void* arg) {
+    TrechoMerge* t = (TrechoMerge*)arg;
+    intercalarNome(t->arr, t->aux, t->inicio, t->meio, t->fim, &t->comparacoes);
+    SOMAR(metricaMerge, t->comparacoes);
+    return NULL;
+}
+
+/*
+ * Merge Sort paralelo - Ordenação por nome (alfabética)
+ * Complexidade: O(n log n) de trabalho, dividido entre numThreads threads
+ * Cada thread ordena um trecho contíguo do vetor; depois os trechos são
+ * intercalados aos pares, também em paralelo, até restar um único trecho
+ */
+void mergeSortParaleloNome(Componente arr[], int n, int numThreads) {
+    if (n < 2) {
+        return;
+    }
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+    if (numThreads > MAX_THREADS) {
+        numThreads = MAX_THREADS;
+    }
+    if (numThreads > n) {
+        numThreads = n;
+    }
+    
+    Componente* aux = (Componente*)malloc(n * sizeof(Componente));
+    if (aux == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return;
+    }
+    
+    // Limites dos trechos: trecho t vai de limites[t] até limites[t + 1]
+    int limites[MAX_THREADS + 1];
+    for (int t = 0; t <= numThreads; t++) {
+        limites[t] = (int)((long long)n * t / numThreads);
+    }
+    
+    pthread_t threads[MAX_THREADS];
+    int criada[MAX_THREADS];
+    TrechoMerge trechos[MAX_THREADS];
+    
+    // Fase 1: cada thread ordena o seu trecho
+    for (int t = 0; t < numThreads; t++) {
+        trechos[t] = (TrechoMerge){arr, aux, limites[t], 0, limites[t + 1], 0};
+        criada[t] = pthread_create(&threads[t], NULL, ordenarTrecho, &trechos[t]) == 0;
+        if (!criada[t]) {
+            ordenarTrecho(&trechos[t]); // Sem thread disponível: ordena aqui mesmo
+        }
+    }
+    for (int t = 0; t < numThreads; t++) {
+        if (criada[t]) {
+            pthread_join(threads[t], NULL);
+        }
+    }
+    
+    // Fase 2: intercala trechos vizinhos aos pares, dobrando a largura a cada rodada
+    for (int largura = 1; largura < numThreads; largura *= 2) {
+        int pares = 0;
+        for (int t = 0; t + largura < numThreads; t += 2 * largura) {
+            int ultimo = t + 2 * largura < numThreads ? t + 2 * largura : numThreads;
+            trechos[pares] = (TrechoMerge){arr, aux, limites[t], limites[t + largura], limites[ultimo], 0};
+            criada[pares] = pthread_create(&threads[pares], NULL, intercalarTrecho, &trechos[pares]) == 0;
+            if (!criada[pares]) {
+                intercalarTrecho(&trechos[pares]);
+            }
+            pares++;
+        }
+        for (int p = 0; p < pares; p++) {
+            if (criada[p]) {
+                pthread_join(threads[p], NULL);
+            }
+        }
+    }
+    
+    free(aux);
+}
+
+/*
+ * Merge Sort paralelo com o número de threads configurado no menu
+ * Tem a mesma assinatura dos demais algoritmos para uso em medirTempo
+ */
+void mergeSortNome(Componente arr[], int n) {
+    mergeSortParaleloNome(arr, n, threadsMergeSort);
+}
+
+/*
+ * ========================================
+ * FILA DE BUCKETS POR PRIORIDADE
+ * ========================================
+ */
+
+/*
+ * Inicializa a fila com todos os baldes vazios
+ */
+void inicializarFilaBuckets(FilaBuckets* fila) {
+    for (int p = 0; p < TOTAL_PRIORIDADES; p++) {
+        fila->inicio[p] = -1;
+        fila->fim[p] = -1;
+    }
+    fila->maiorOcupado = -1;
+    fila->total = 0;
+}
+
+/*
+ * Insere o componente arr[indice] no final do balde da sua prioridade
+ * Complexidade: O(1)
+ */
+void inserirFilaBuckets(FilaBuckets* fila, Componente arr[], int indice) {
+    int balde = arr[indice].prioridade - PRIORIDADE_MIN;
+    
+    fila->proximo[indice] = -1;
+    if (fila->fim[balde] == -1) {
+        fila->inicio[balde] = indice;
+    } else {
+        fila->proximo[fila->fim[balde]] = indice;
+    }
+    fila->fim[balde] = indice;
+    
+    if (balde > fila->maiorOcupado) {
+        fila->maiorOcupado = balde;
+    }
+    fila->total++;
+}
+
+/*
+ * Retira o próximo componente de maior prioridade (10 antes de 1)
+ * Componentes de mesma prioridade saem na ordem em que entraram
+ * Complexidade: O(1) amortizado, no máximo 10 baldes percorridos
+ * Retorna o índice do componente ou -1 se a fila estiver vazia
+ */
+int retirarMaiorPrioridade(FilaBuckets* fila) {
+    while (fila->maiorOcupado >= 0 && fila->inicio[fila->maiorOcupado] == -1) {
+        fila->maiorOcupado--;
+    }
+    
+    if (fila->maiorOcupado < 0) {
+        return -1;
+    }
+    
+    int balde = fila->maiorOcupado;
+    int indice = fila->inicio[balde];
+    
+    fila->inicio[balde] = fila->proximo[indice];
+    if (fila->inicio[balde] == -1) {
+        fila->fim[balde] = -1;
+    }
+    fila->total--;
+    
+    return indice;
+}
+
+/*
+ * Retira os componentes um a um, sempre o de maior prioridade primeiro
+ */
+void retirarPorPrioridade() {
+    printf("=== RETIRADA POR PRIORIDADE (FILA DE BUCKETS) ===\n");
+    
+    if (totalComponentes == 0) {
+        printf("❌ Nenhum componente cadastrado!\n");
+        return;
+    }
+    
+    FilaBuckets fila;
+    inicializarFilaBuckets(&fila);
+    for (int i = 0; i < totalComponentes; i++) {
+        inserirFilaBuckets(&fila, torre, i);
+    }
+    
+    printf("%d componentes na fila.\n\n", fila.total);
+    
+    char resposta = 's';
+    while (fila.total > 0 && (resposta == 's' || resposta == 'S')) {
+        int indice = retirarMaiorPrioridade(&fila);
+        printf("📤 Próximo: %s (Tipo: %s, Prioridade: %d)\n",
+               torre[indice].nome, torre[indice].tipo, torre[indice].prioridade);
+        
+        if (fila.total > 0) {
+            printf("Retirar o próximo? (s/n): ");
+            scanf(" %c", &resposta);
+            limparBuffer();
+        }
+    }
+    
+    if (fila.total == 0) {
+        printf("✅ Todos os componentes foram retirados.\n");
+    } else {
+        printf("Retirada interrompida. Restam %d componentes na fila.\n", fila.total);
+    }
+}
+
+/*
+ * ========================================
+ * ESTADOS CONGELADOS (COPY-ON-WRITE)
+ * ========================================
+ *
+ * Os testes de escala rodam vários algoritmos sobre a mesma entrada de até
+ * milhões de componentes. Em vez de manter uma segunda cópia do vetor e
+ * restaurá-la com memcpy antes de cada algoritmo, a entrada é congelada uma
+ * vez em um memfd e cada execução recebe uma bifurcação: um mmap MAP_PRIVATE
+ * do memfd, criado e descartado em uma chamada ao sistema cada. O kernel só
+ * copia uma página quando alguém escreve nela pela primeira vez, e o estado
+ * congelado nunca muda, então não há nada a restaurar; ao descartar, as
+ * páginas copiadas voltam para o sistema.
+ *
+ * Uma ordenação escreve em praticamente todas as páginas, então as medições
+ * chamam prepararBifurcacao() antes de disparar o relógio: as faltas de
+ * página ficam fora do tempo medido. A torre (até MAX_COMPONENTES, menos de
+ * uma página) não passa por aqui: memfd, mmap e a falta de página custariam
+ * mais que copiar 2 KB, e as comparações dela usam uma cópia na pilha.
+ *
+ * Sem memfd (kernel antigo ou sem permissão), o estado fica em uma cópia
+ * comum e cada bifurcação volta a ser um memcpy.
+ */
+
+/*
+ * Congela os n componentes de arr; retorna 0 se faltar memória
+ */
+int congelarEstado(EstadoCongelado* estado, const Componente arr[], int n) {
+    estado->n = n;
+    estado->bytes = (size_t)(n > 0 ? n : 1) * sizeof(Componente);
+    estado->copiaReserva = NULL;
+    estado->descritor = memfd_create("torre-congelada", MFD_CLOEXEC);
+    
+    if (estado->descritor >= 0) {
+        void* destino = MAP_FAILED;
+        if (ftruncate(estado->descritor, (off_t)estado->bytes) == 0) {
+            destino = mmap(NULL, estado->bytes, PROT_WRITE, MAP_SHARED, estado->descritor, 0);
+        }
+        if (destino != MAP_FAILED) {
+            memcpy(destino, arr, (size_t)n * sizeof(Componente));
+            munmap(destino, estado->bytes);
+            return 1;
+        }
+        close(estado->descritor);
+        estado->descritor = -1;
+    }
+    
+    estado->copiaReserva = (Componente*)malloc(estado->bytes);
+    if (estado->copiaReserva == NULL) {
+        return 0;
+    }
+    memcpy(estado->copiaReserva, arr, (size_t)n * sizeof(Componente));
+    return 1;
+}
+
+/*
+ * Nova visão gravável do estado congelado; retorna NULL se faltar memória
+ * As escritas ficam só nesta bifurcação
+ */
+Componente* bifurcarEstado(const EstadoCongelado* estado) {
+    if (estado->descritor >= 0) {
+        void* bifurcacao = mmap(NULL, estado->bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, estado->descritor, 0);
+        return bifurcacao != MAP_FAILED ? (Componente*)bifurcacao : NULL;
+    }
+    
+    Componente* bifurcacao = (Componente*)malloc(estado->bytes);
+    if (bifurcacao != NULL) {
+        memcpy(bifurcacao, estado->copiaReserva, (size_t)estado->n * sizeof(Componente));
+    }
+    return bifurcacao;
+}
+
+/*
+ * Faz agora as cópias de página que as escritas fariam, para que elas não
+ * caiam no tempo medido (MADV_POPULATE_WRITE; sem ele, escreve em cada página)
+ */
+void prepararBifurcacao(const EstadoCongelado* estado, Componente* bifurcacao) {
+    if (bifurcacao == NULL || estado->descritor < 0) {
+        return; // Uma bifurcação feita com memcpy já está toda copiada
+    }
+#ifdef MADV_POPULATE_WRITE
+    if (madvise(bifurcacao, estado->bytes, MADV_POPULATE_WRITE) == 0) {
+        return;
+    }
+#endif
+    volatile char* bytes = (volatile char*)bifurcacao;
+    size_t pagina = (size_t)sysconf(_SC_PAGESIZE);
+    for (size_t b = 0; b < estado->bytes; b += pagina) {
+        bytes[b] = bytes[b];
+    }
+}
+
+/*
+ * Descarta a bifurcação e todas as suas escritas
+ */
+void descartarBifurcacao(const EstadoCongelado* estado, Componente* bifurcacao) {
+    if (bifurcacao == NULL) {
+        return;
+    }
+    if (estado->descritor >= 0) {
+        munmap(bifurcacao, estado->bytes);
+    } else {
+        free(bifurcacao);
+    }
+}
+
+void liberarEstado(EstadoCongelado* estado) {
+    if (estado->descritor >= 0) {
+        close(estado->descritor);
+        estado->descritor = -1;
+    }
+    free(estado->copiaReserva);
+    estado->copiaReserva = NULL;
+}
+
+/*
+ * Função para medir tempo de execução de algoritmos de ordenação
+ * Ordena arr no próprio lugar; para medir sem alterar a entrada, passe
+ * uma cópia (veja compararAlgoritmos)
+ */
+double medirTempo(void (*algoritmo)(Componente[], int), Componente arr[], int n) {
+    clock_t inicio = clock();
+    algoritmo(arr, n);
+    clock_t fim = clock();
+    
+    return ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+}
+
+/*
+ * Mede o algoritmo sobre uma cópia da torre feita fora do tempo medido
+ * A torre cabe em menos de uma página: copiar é mais barato que bifurcar
+ */
+static double medirTempoCopia(void (*algoritmo)(Componente[], int)) {
+    Componente copia[MAX_COMPONENTES];
+    memcpy(copia, torre, totalComponentes * sizeof(Componente));
+    return medirTempo(algoritmo, copia, totalComponentes);
+}
+
+/*
+ * Tempo de relógio de parede em segundos
+ * clock() soma o tempo de CPU de todas as threads, então não serve para
+ * medir algoritmos paralelos
+ */
+double relogioParede() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Função para comparar todos os algoritmos de ordenação
+ * Cada algoritmo ordena sua própria cópia da torre; a torre em si não é
+ * alterada, então as flags de ordenação continuam valendo
+ */
+void compararAlgoritmos() {
+    if (totalComponentes < 2) {
+        printf("❌ É necessário ter pelo menos 2 componentes para comparar algoritmos!\n");
+        return;
+    }
+    
+    printf("=== COMPARAÇÃO DE ALGORITMOS DE ORDENAÇÃO ===\n");
+    printf("Testando com %d componentes...\n\n", totalComponentes);
+    
+    // Testa Bubble Sort
+    printf("🔵 BUBBLE SORT (por nome):\n");
+    resetarContadores();
+    double tempoBubble = medirTempoCopia(bubbleSortNome);
+    int compBubble = (int)lerMetrica(metricaBubble);
+    printf("├─ Comparações: %d\n", compBubble);
+    printf("└─ Tempo: %.6f segundos\n\n", tempoBubble);
+    
+    // Testa Insertion Sort
+    printf("🟢 INSERTION SORT (por tipo):\n");
+    resetarContadores();
+    double tempoInsertion = medirTempoCopia(insertionSortTipo);
+    int compInsertion = (int)lerMetrica(metricaInsertion);
+    printf("├─ Comparações: %d\n", compInsertion);
+    printf("└─ Tempo: %.6f segundos\n\n", tempoInsertion);
+    
     // Testa Selection Sort
     printf("🟡 SELECTION SORT (por prioridade):\n");
     resetarContadores();
-    double tempoSelection = medirTempo(selectionSortPrioridade, torre, totalComponentes);
-    printf("├─ Comparações: %d\n", comparacoesSelection);
-    printf("└─ Tempo: %.6f segundos\n\n", tempoSelection);
+    double tempoSelection = medirTempoCopia(selectionSortPrioridade);
+    int compSelection = (int)lerMetrica(metricaSelection);
+    printf("├─ Comparações: %d\n", compSelection);
+    printf("└─ Tempo: %.6f segundos\n\n", tempoSelection);
+    
+    // Testa Counting Sort
+    printf("🟣 COUNTING SORT (por prioridade):\n");
+    resetarContadores();
+    double tempoCounting = medirTempoCopia(countingSortPrioridade);
+    int opCounting = (int)lerMetrica(metricaCounting);
+    printf("├─ Comparações: 0\n");
+    printf("├─ Operações de contagem: %d\n", opCounting);
+    printf("└─ Tempo: %.6f segundos\n\n", tempoCounting);
+    
+    // Análise comparativa
+    printf("📊 ANÁLISE COMPARATIVA:\n");
+    
+    // Algoritmo mais rápido
+    if (tempoCounting <= tempoBubble && tempoCounting <= tempoInsertion && tempoCounting <= tempoSelection) {
+        printf("🏆 Algoritmo mais rápido: Counting Sort\n");
+    } else if (tempoBubble <= tempoInsertion && tempoBubble <= tempoSelection) {
+        printf("🏆 Algoritmo mais rápido: Bubble Sort\n");
+    } else if (tempoInsertion <= tempoBubble && tempoInsertion <= tempoSelection) {
+        printf("🏆 Algoritmo mais rápido: Insertion Sort\n");
+    } else {
+        printf("🏆 Algoritmo mais rápido: Selection Sort\n");
+    }
+    
+    // Algoritmo com menos comparações (Counting Sort não compara elementos)
+    printf("🎯 Menos comparações: Counting Sort (0, com %d operações de contagem)\n", opCounting);
+    if (compBubble <= compInsertion && compBubble <= compSelection) {
+        printf("🥈 Entre os comparativos: Bubble Sort (%d)\n", compBubble);
+    } else if (compInsertion <= compBubble && compInsertion <= compSelection) {
+        printf("🥈 Entre os comparativos: Insertion Sort (%d)\n", compInsertion);
+    } else {
+        printf("🥈 Entre os comparativos: Selection Sort (%d)\n", compSelection);
+    }
+    
+    printf("\n💡 RECOMENDAÇÕES:\n");
+    printf("├─ Para chaves com poucos valores (prioridade): Counting Sort\n");
+    printf("├─ Para dados quase ordenados: Insertion Sort\n");
+    printf("├─ Para dados pequenos: Qualquer algoritmo\n");
+    printf("├─ Para dados grandes: Considere algoritmos O(n log n)\n");
+    printf("└─ Para busca frequente: Ordene primeiro, depois use busca binária\n");
+    
+    printf("=============================================\n");
+}
+
+
+// Execução isolada de um algoritmo em uma thread fixada a um núcleo
+typedef struct {
+    const char* nome;
+    void (*algoritmo)(Componente[], int);
+    int metrica;        // Métrica exclusiva deste algoritmo
+    Componente* copia;  // Cópia privada da torre
+    int n;
+    int cpu;            // Núcleo ao qual a thread foi fixada
+    int fixada;         // 1 se a afinidade foi aplicada
+    double tempo;       // Tempo de CPU da própria thread
+} ExecucaoParalela;
+
+static void* executarAlgoritmo(void* arg) {
+    ExecucaoParalela* e = (ExecucaoParalela*)arg;
+    struct timespec inicio, fim;
+    
+    // Tempo de CPU da thread: não é afetado pelas outras execuções
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &inicio);
+    e->algoritmo(e->copia, e->n);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &fim);
+    
+    e->tempo = (fim.tv_sec - inicio.tv_sec) + (fim.tv_nsec - inicio.tv_nsec) / 1e9;
+    return NULL;
+}
+
+/*
+ * Compara os algoritmos executando todos ao mesmo tempo
+ * Cada algoritmo roda em sua própria thread, fixada a um núcleo, sobre uma
+ * cópia da torre; torre não é alterada
+ */
+void compararAlgoritmosParalelo() {
+    if (totalComponentes < 2) {
+        printf("❌ É necessário ter pelo menos 2 componentes para comparar algoritmos!\n");
+        return;
+    }
+    
+    ExecucaoParalela execucoes[] = {
+        {"🔵 BUBBLE SORT (por nome)", bubbleSortNome, metricaBubble, NULL, 0, 0, 0, 0},
+        {"🟢 INSERTION SORT (por tipo)", insertionSortTipo, metricaInsertion, NULL, 0, 0, 0, 0},
+        {"🟡 SELECTION SORT (por prioridade)", selectionSortPrioridade, metricaSelection, NULL, 0, 0, 0, 0},
+        {"🟣 COUNTING SORT (por prioridade)", countingSortPrioridade, metricaCounting, NULL, 0, 0, 0, 0}
+    };
+    int total = sizeof(execucoes) / sizeof(execucoes[0]);
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+    if (nucleos < 1) {
+        nucleos = 1;
+    }
+    
+    printf("=== COMPARAÇÃO PARALELA DE ALGORITMOS ===\n");
+    printf("Testando com %d componentes em %d threads (%ld núcleos)...\n\n",
+           totalComponentes, total, nucleos);
+    
+    SnapshotMetricas antes, depois, delta;
+    capturarMetricas(&antes);
+    pthread_t threads[sizeof(execucoes) / sizeof(execucoes[0])];
+    int criada[sizeof(execucoes) / sizeof(execucoes[0])];
+    
+    Componente copias[sizeof(execucoes) / sizeof(execucoes[0])][MAX_COMPONENTES];
+    for (int i = 0; i < total; i++) {
+        execucoes[i].n = totalComponentes;
+        execucoes[i].cpu = (int)(i % nucleos);
+        execucoes[i].copia = copias[i];
+        memcpy(copias[i], torre, totalComponentes * sizeof(Componente));
+    }
+    
+    for (int i = 0; i < total; i++) {
+        pthread_attr_t atributos;
+        cpu_set_t cpus;
+        
+        pthread_attr_init(&atributos);
+        CPU_ZERO(&cpus);
+        CPU_SET(execucoes[i].cpu, &cpus);
+        execucoes[i].fixada = pthread_attr_setaffinity_np(&atributos, sizeof(cpus), &cpus) == 0;
+        
+        criada[i] = pthread_create(&threads[i], &atributos, executarAlgoritmo, &execucoes[i]) == 0;
+        if (!criada[i]) {
+            // Sem thread disponível: executa na thread principal
+            execucoes[i].fixada = 0;
+            executarAlgoritmo(&execucoes[i]);
+        }
+        pthread_attr_destroy(&atributos);
+    }
+    
+    for (int i = 0; i < total; i++) {
+        if (criada[i]) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+    
+    // Cada thread contou na própria fatia; a diferença soma todas elas
+    capturarMetricas(&depois);
+    diferencaMetricas(&depois, &antes, &delta);
+    
+    int maisRapido = 0;
+    for (int i = 0; i < total; i++) {
+        printf("%s:\n", execucoes[i].nome);
+        printf("├─ Núcleo: %d%s\n", execucoes[i].cpu, execucoes[i].fixada ? "" : " (sem fixação)");
+        printf("├─ %s: %llu\n", execucoes[i].metrica == metricaCounting ?
+               "Operações de contagem" : "Comparações", delta.valores[execucoes[i].metrica]);
+        printf("└─ Tempo de CPU da thread: %.6f segundos\n\n", execucoes[i].tempo);
+        
+        if (execucoes[i].tempo < execucoes[maisRapido].tempo) {
+            maisRapido = i;
+        }
+    }
+    
+    printf("📊 ANÁLISE COMPARATIVA:\n");
+    printf("└─ 🏆 Algoritmo mais rápido: %s\n", execucoes[maisRapido].nome);
+    printf("=============================================\n");
+}
+
+/*
+ * Preenche arr com n componentes de nomes, tipos e prioridades aleatórios
+ * Usado nos testes de escala, muito além do limite de MAX_COMPONENTES
+ */
+void gerarComponentesAleatorios(Componente arr[], int n) {
+    for (int i = 0; i < n; i++) {
+        snprintf(arr[i].nome, TAMANHO_NOME, "componente-%08d", rand() % 100000000);
+        strcpy(arr[i].tipo, tiposGerados[rand() % TOTAL_TIPOS_GERADOS]);
+        arr[i].prioridade = PRIORIDADE_MIN + rand() % TOTAL_PRIORIDADES;
+        prepararChaves(&arr[i]);
+    }
+}
+
+/*
+ * Mede o Merge Sort paralelo em um inventário grande gerado aleatoriamente,
+ * comparando 1 thread com o número de threads escolhido
+ */
+void testarEscalaMergeSort() {
+    int n, threads;
+    
+    printf("=== TESTE DE ESCALA: MERGE SORT PARALELO ===\n");
+    printf("Quantidade de componentes (ex: 1000000): ");
+    scanf("%d", &n);
+    limparBuffer();
+    printf("Número de threads (1-%d): ", MAX_THREADS);
+    scanf("%d", &threads);
+    limparBuffer();
+    
+    if (n < 2 || threads < 1 || threads > MAX_THREADS) {
+        printf("❌ Parâmetros inválidos!\n");
+        return;
+    }
+    
+    Componente* original = (Componente*)malloc((size_t)n * sizeof(Componente));
+    if (original == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return;
+    }
+    
+    printf("🔄 Gerando %d componentes aleatórios...\n\n", n);
+    gerarComponentesAleatorios(original, n);
+    
+    // Cada configuração ordena uma bifurcação da entrada congelada
+    EstadoCongelado estado;
+    int congelado = congelarEstado(&estado, original, n);
+    free(original);
+    if (!congelado) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return;
+    }
+    
+    double tempos[2] = {0.0, 0.0};
+    int configuracoes[2] = {1, threads};
+    
+    for (int c = 0; c < 2; c++) {
+        Componente* copia = bifurcarEstado(&estado);
+        if (copia == NULL) {
+            printf("❌ ERRO: Falha na alocação de memória!\n");
+            break;
+        }
+        prepararBifurcacao(&estado, copia);
+        resetarContadores();
+        double inicio = relogioParede();
+        mergeSortParaleloNome(copia, n, configuracoes[c]);
+        tempos[c] = relogioParede() - inicio;
+        
+        int ordenado = 1;
+        for (int i = 1; i < n && ordenado; i++) {
+            ordenado = strcmp(copia[i - 1].chaveNome, copia[i].chaveNome) <= 0;
+        }
+        
+        descartarBifurcacao(&estado, copia);
+        
+        printf("🧵 %d thread(s):\n", configuracoes[c]);
+        printf("├─ Comparações: %llu\n", lerMetrica(metricaMerge));
+        printf("├─ Resultado: %s\n", ordenado ? "✅ Ordenado" : "❌ Fora de ordem");
+        printf("└─ Tempo: %.6f segundos\n\n", tempos[c]);
+    }
+    liberarEstado(&estado);
+    
+    printf("📊 Speedup com %d threads: %.2fx\n", threads,
+           tempos[1] > 0 ? tempos[0] / tempos[1] : 1.0);
+    printf("=============================================\n");
+}
+
+/*
+ * Mede os laços instrumentados em entradas grandes
+ * Execute a compilação normal e a de make INSTRUMENTACAO=0: a diferença
+ * entre os tempos é o custo das contagens nos laços internos
+ */
+void medirCustoInstrumentacao() {
+    const int nQuadratico = 3000;    // Bubble, Insertion e Selection
+    const int nLinear = 200000;      // Counting, Merge e buscas
+    const int totalBuscas = 1000000;
+    
+    Componente* original = (Componente*)malloc((size_t)nLinear * sizeof(Componente));
+    if (original == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return;
+    }
+    
+    printf("=== CUSTO DA INSTRUMENTAÇÃO ===\n");
+    printf("Compilação: %s\n\n", INSTRUMENTACAO ? "instrumentada (INSTRUMENTACAO=1)" :
+                                                 "sem instrumentação (INSTRUMENTACAO=0)");
+    
+    srand(42); // Mesma entrada nas duas compilações
+    gerarComponentesAleatorios(original, nLinear);
+    
+    EstadoCongelado estado;
+    if (!congelarEstado(&estado, original, nLinear)) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        free(original);
+        return;
+    }
+    
+    struct {
+        const char* nome;
+        void (*algoritmo)(Componente[], int);
+        int n;
+    } ordenacoes[] = {
+        {"Bubble Sort", bubbleSortNome, nQuadratico},
+        {"Insertion Sort", insertionSortTipo, nQuadratico},
+        {"Selection Sort", selectionSortPrioridade, nQuadratico},
+        {"Counting Sort", countingSortPrioridade, nLinear},
+        {"Merge Sort (1 thread)", mergeSortNome, nLinear}
+    };
+    int totalOrdenacoes = sizeof(ordenacoes) / sizeof(ordenacoes[0]);
+    int threadsAnteriores = threadsMergeSort;
+    threadsMergeSort = 1;
+    
+    double tempoTotal = 0.0;
+    Componente* copia = NULL;
+    for (int i = 0; i < totalOrdenacoes; i++) {
+        descartarBifurcacao(&estado, copia);
+        copia = bifurcarEstado(&estado);
+        if (copia == NULL) {
+            break;
+        }
+        prepararBifurcacao(&estado, copia);
+        double inicio = relogioParede();
+        ordenacoes[i].algoritmo(copia, ordenacoes[i].n);
+        double tempo = relogioParede() - inicio;
+        tempoTotal += tempo;
+        printf("├─ %s (%d itens): %.6f segundos\n", ordenacoes[i].nome, ordenacoes[i].n, tempo);
+    }
+    threadsMergeSort = threadsAnteriores;
+    if (copia == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        liberarEstado(&estado);
+        free(original);
+        return;
+    }
+    
+    // A última bifurcação está ordenada por nome após o Merge Sort
+    int encontrados = 0;
+    double inicio = relogioParede();
+    for (int b = 0; b < totalBuscas; b++) {
+        encontrados += buscaBinariaPorNome(copia, nLinear, original[b % nLinear].nome) != -1;
+    }
+    double tempoBuscas = relogioParede() - inicio;
+    tempoTotal += tempoBuscas;
+    printf("└─ %d buscas binárias (%d encontradas): %.6f segundos\n\n",
+           totalBuscas, encontrados, tempoBuscas);
+    
+    printf("⏱️  Tempo total: %.6f segundos\n", tempoTotal);
+    printf("💡 Compare com a outra compilação:\n");
+    printf("   make                    (build/release/mestre)\n");
+    printf("   make INSTRUMENTACAO=0   (build/release-sem-metricas/mestre)\n");
+    printf("=============================================\n");
+    
+    descartarBifurcacao(&estado, copia);
+    liberarEstado(&estado);
+    free(original);
+}
+
+// Comparadores indiretos no estilo qsort, usados como referência e na verificação
+static int compararNomeQsort(const void* a, const void* b) {
+    return strcmp(((const Componente*)a)->chaveNome, ((const Componente*)b)->chaveNome);
+}
+
+static int compararTipoQsort(const void* a, const void* b) {
+    return strcmp(((const Componente*)a)->chaveTipo, ((const Componente*)b)->chaveTipo);
+}
+
+static int compararPrioridadeQsort(const void* a, const void* b) {
+    return ((const Componente*)a)->prioridade - ((const Componente*)b)->prioridade;
+}
+
+static void qsortNome(Componente arr[], int n) {
+    qsort(arr, n, sizeof(Componente), compararNomeQsort);
+}
+
+static void qsortTipo(Componente arr[], int n) {
+    qsort(arr, n, sizeof(Componente), compararTipoQsort);
+}
+
+static void qsortPrioridade(Componente arr[], int n) {
+    qsort(arr, n, sizeof(Componente), compararPrioridadeQsort);
+}
+
+/*
+ * Compara, para cada chave, os algoritmos gerados pelo motor genérico com o
+ * qsort (comparação por ponteiro de função) e com a ordenação original do menu
+ * Roda em dois cenários: entrada aleatória e torre já ordenada pela chave com
+ * 1% de componentes novos no fim (o caso de reordenar depois de cadastrar)
+ * Os algoritmos O(n²) só rodam até LIMITE_QUADRATICO itens
+ */
+void compararMotorOrdenacao() {
+    const int LIMITE_QUADRATICO = 5000;
+    int n;
+    
+    printf("=== MOTOR DE ORDENAÇÃO GENÉRICO x QSORT ===\n");
+    printf("Quantidade de componentes (ex: 100000): ");
+    scanf("%d", &n);
+    limparBuffer();
+    
+    if (n < 2) {
+        printf("❌ Parâmetros inválidos!\n");
+        return;
+    }
+    
+    Componente* original = (Componente*)malloc((size_t)n * sizeof(Componente));
+    if (original == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return;
+    }
+    
+    printf("🔄 Gerando %d componentes aleatórios...\n\n", n);
+    gerarComponentesAleatorios(original, n);
+    
+    typedef struct {
+        const char* nome;
+        void (*ordenar)(Componente[], int);
+        int quadratico;
+    } OpcaoOrdenacao;
+    
+    struct {
+        const char* chave;
+        int (*comparar)(const void*, const void*);
+        void (*preOrdenar)(Componente[], int);
+        OpcaoOrdenacao opcoes[8];
+    } chaves[] = {
+        {"NOME", compararNomeQsort, ordenarQuickNome, {
+            {"Bubble (genérico)", ordenarBubbleNome, 1},
+            {"Insertion (genérico)", ordenarInsertionNome, 1},
+            {"Selection (genérico)", ordenarSelectionNome, 1},
+            {"Merge (genérico)", ordenarMergeNome, 0},
+            {"Quick (genérico)", ordenarQuickNome, 0},
+            {"Natural (genérico)", ordenarNaturalNome, 0},
+            {"qsort", qsortNome, 0},
+            {"bubbleSortNome (menu)", bubbleSortNome, 1}}},
+        {"TIPO", compararTipoQsort, ordenarQuickTipo, {
+            {"Bubble (genérico)", ordenarBubbleTipo, 1},
+            {"Insertion (genérico)", ordenarInsertionTipo, 1},
+            {"Selection (genérico)", ordenarSelectionTipo, 1},
+            {"Merge (genérico)", ordenarMergeTipo, 0},
+            {"Quick (genérico)", ordenarQuickTipo, 0},
+            {"Natural (genérico)", ordenarNaturalTipo, 0},
+            {"qsort", qsortTipo, 0},
+            {"insertionSortTipo (menu)", insertionSortTipo, 1}}},
+        {"PRIORIDADE", compararPrioridadeQsort, ordenarQuickPrioridade, {
+            {"Bubble (genérico)", ordenarBubblePrioridade, 1},
+            {"Insertion (genérico)", ordenarInsertionPrioridade, 1},
+            {"Selection (genérico)", ordenarSelectionPrioridade, 1},
+            {"Merge (genérico)", ordenarMergePrioridade, 0},
+            {"Quick (genérico)", ordenarQuickPrioridade, 0},
+            {"Natural (genérico)", ordenarNaturalPrioridade, 0},
+            {"qsort", qsortPrioridade, 0},
+            {"selectionSortPrioridade (menu)", selectionSortPrioridade, 1}}}
+    };
+    int totalChaves = sizeof(chaves) / sizeof(chaves[0]);
+    int totalOpcoes = sizeof(chaves[0].opcoes) / sizeof(chaves[0].opcoes[0]);
+    
+    const char* nomesCenarios[] = {" (aleatória)", " (ordenada + 1% novos no fim)"};
+    int novos = n / 100 > 0 ? n / 100 : 1;
+    
+    int semMemoria = 0;
+    for (int cenario = 0; cenario < 2 && !semMemoria; cenario++) {
+        for (int c = 0; c < totalChaves && !semMemoria; c++) {
+            if (cenario == 1) {
+                chaves[c].preOrdenar(original, n);
+                gerarComponentesAleatorios(original + n - novos, novos);
+            }
+            // A entrada desta chave é congelada; cada opção ordena uma bifurcação
+            EstadoCongelado estado;
+            if (!congelarEstado(&estado, original, n)) {
+                semMemoria = 1;
+                break;
+            }
+            printf("🔑 CHAVE: %s%s\n", chaves[c].chave, nomesCenarios[cenario]);
+            int melhor = -1;
+            double tempoMelhor = 0.0;
+            double tempoQsort = 0.0;
+            
+            for (int o = 0; o < totalOpcoes; o++) {
+                const OpcaoOrdenacao* opcao = &chaves[c].opcoes[o];
+                const char* ramo = o == totalOpcoes - 1 ? "└─" : "├─";
+                if (opcao->quadratico && n > LIMITE_QUADRATICO) {
+                    printf("%s %s: ignorado (O(n²) acima de %d itens)\n", ramo, opcao->nome, LIMITE_QUADRATICO);
+                    continue;
+                }
+                
+                Componente* copia = bifurcarEstado(&estado);
+                if (copia == NULL) {
+                    semMemoria = 1;
+                    break;
+                }
+                prepararBifurcacao(&estado, copia);
+                double inicio = relogioParede();
+                opcao->ordenar(copia, n);
+                double tempo = relogioParede() - inicio;
+                
+                int ordenado = 1;
+                for (int i = 1; i < n && ordenado; i++) {
+                    ordenado = chaves[c].comparar(&copia[i - 1], &copia[i]) <= 0;
+                }
+                descartarBifurcacao(&estado, copia);
+                
+                printf("%s %s: %.6f segundos%s\n", ramo, opcao->nome, tempo, ordenado ? "" : " ❌ fora de ordem");
+                if (opcao->ordenar == qsortNome || opcao->ordenar == qsortTipo || opcao->ordenar == qsortPrioridade) {
+                    tempoQsort = tempo;
+                }
+                if (ordenado && (melhor == -1 || tempo < tempoMelhor)) {
+                    melhor = o;
+                    tempoMelhor = tempo;
+                }
+            }
+            
+            liberarEstado(&estado);
+            
+            if (melhor != -1 && !semMemoria) {
+                printf("🏆 Mais rápido para %s: %s (%.2fx o qsort)\n\n", chaves[c].chave,
+                       chaves[c].opcoes[melhor].nome, tempoMelhor > 0 ? tempoQsort / tempoMelhor : 1.0);
+            }
+        }
+    }
+    if (semMemoria) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+    }
+    printf("=============================================\n");
+    
+    free(original);
+}
+
+/*
+ * ========================================
+ * CONSULTAS POR FILTRO (MAPAS DE SELEÇÃO)
+ * ========================================
+ */
+
+/*
+ * Lista os componentes de um tipo com prioridade em uma faixa, por exemplo
+ * "tipo = propulsão E prioridade entre 7 e 10" ou só "prioridade >= 8"
+ * Cada condição vira um mapa de bits sobre as colunas; a tabela mostra a
+ * posição de cadastro, como a listagem por prefixo
+ */
+void filtrarComponentes() {
+    if (colunas.total == 0) {
+        printf("❌ Nenhum componente cadastrado!\n");
+        return;
+    }
+    
+    char tipo[TAMANHO_TIPO];
+    char chaveTipo[TAMANHO_TIPO];
+    int minimo, maximo;
+    
+    printf("=== FILTRAR COMPONENTES ===\n");
+    printf("Tipo (vazio para qualquer): ");
+    if (!lerTexto(tipo, TAMANHO_TIPO)) {
+        printf("❌ ERRO: Tipo muito longo (máximo %d caracteres)!\n", TAMANHO_TIPO - 1);
+        return;
+    }
+    normalizarTexto(tipo, chaveTipo, TAMANHO_TIPO);
+    printf("Prioridade mínima (%d-%d): ", PRIORIDADE_MIN, PRIORIDADE_MAX);
+    scanf("%d", &minimo);
+    printf("Prioridade máxima (%d-%d): ", PRIORIDADE_MIN, PRIORIDADE_MAX);
+    scanf("%d", &maximo);
+    limparBuffer();
+    
+    if (minimo < PRIORIDADE_MIN) {
+        minimo = PRIORIDADE_MIN;
+    }
+    if (maximo > PRIORIDADE_MAX) {
+        maximo = PRIORIDADE_MAX;
+    }
+    if (minimo > maximo) {
+        printf("❌ Faixa de prioridade inválida!\n");
+        return;
+    }
+    
+    unsigned long long selecao[PALAVRAS_SELECAO(MAX_COMPONENTES)];
+    selecionarFaixaByte(colunas.prioridades, colunas.total, (unsigned char)minimo, (unsigned char)maximo, selecao);
+    if (chaveTipo[0] != '\0') {
+        unsigned long long porTipo[PALAVRAS_SELECAO(MAX_COMPONENTES)];
+        selecionarTipoColunar(&colunas, chaveTipo, porTipo);
+        intersectarSelecao(selecao, porTipo, colunas.total);
+    }
+    
+    printf("\n🔎 Consulta: tipo = %s E prioridade entre %d e %d\n\n",
+           chaveTipo[0] != '\0' ? tipo : "(qualquer)", minimo, maximo);
+    imprimirCabecalhoTabela("Pos", "Prioridade");
+    for (int i = proximoSelecionado(selecao, colunas.total, 0); i != -1;
+         i = proximoSelecionado(selecao, colunas.total, i + 1)) {
+        imprimirLinhaTabela(i + 1, nomeColunar(&colunas, i), tipoColunar(&colunas, i), prioridadeColunar(&colunas, i));
+    }
+    imprimirRodapeTabela();
+    printf("📋 %d de %d componente(s) selecionado(s) (Pos = ordem de cadastro)\n",
+           contarSelecao(selecao, colunas.total), colunas.total);
+}
+
+/*
+ * Mede a consulta "tipo = propulsão E prioridade entre 7 e 10" em um
+ * inventário grande: varrendo os registros (strcmp do tipo e leitura da
+ * prioridade em cada Componente) e varrendo as colunas de 1 byte com SSE2
+ */
+void testarEscalaFiltros() {
+    const int repeticoes = 20;
+    const char* chaveTipo = "propulsao";
+    const int minimo = 7;
+    const int maximo = PRIORIDADE_MAX;
+    int n;
+    
+    printf("=== TESTE DE ESCALA: FILTROS POR COLUNA ===\n");
+    printf("Quantidade de componentes (ex: 1000000): ");
+    scanf("%d", &n);
+    limparBuffer();
+    
+    if (n < 1) {
+        printf("❌ Parâmetros inválidos!\n");
+        return;
+    }
+    
+    size_t palavras = (size_t)PALAVRAS_SELECAO(n);
+    Componente* componentes = (Componente*)malloc((size_t)n * sizeof(Componente));
+    unsigned char* tipoIds = (unsigned char*)malloc((size_t)n);
+    unsigned char* prioridades = (unsigned char*)malloc((size_t)n);
+    unsigned long long* selecaoLinhas = (unsigned long long*)malloc(palavras * sizeof(unsigned long long));
+    unsigned long long* selecao = (unsigned long long*)malloc(palavras * sizeof(unsigned long long));
+    unsigned long long* condicao = (unsigned long long*)malloc(palavras * sizeof(unsigned long long));
+    if (componentes == NULL || tipoIds == NULL || prioridades == NULL || selecaoLinhas == NULL ||
+        selecao == NULL || condicao == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        free(componentes);
+        free(tipoIds);
+        free(prioridades);
+        free(selecaoLinhas);
+        free(selecao);
+        free(condicao);
+        return;
+    }
+    printf("🔄 Gerando %d componentes aleatórios...\n\n", n);
+    gerarComponentesAleatorios(componentes, n);
+    
+    // Colunas de 1 byte: id do tipo (posição no dicionário dos tipos gerados) e prioridade
+    char dicionario[TOTAL_TIPOS_GERADOS][TAMANHO_TIPO];
+    int idBuscado = -1;
+    for (int t = 0; t < TOTAL_TIPOS_GERADOS; t++) {
+        normalizarTexto(tiposGerados[t], dicionario[t], TAMANHO_TIPO);
+        if (strcmp(dicionario[t], chaveTipo) == 0) {
+            idBuscado = t;
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        int id = 0;
+        while (strcmp(dicionario[id], componentes[i].chaveTipo) != 0) {
+            id++; // Todo tipo gerado está no dicionário
+        }
+        tipoIds[i] = (unsigned char)id;
+        prioridades[i] = (unsigned char)componentes[i].prioridade;
+    }
+    
+    // Registros: as mesmas duas condições lidas de cada Componente
+    int selecionadosLinhas = 0;
+    double inicio = relogioParede();
+    for (int r = 0; r < repeticoes; r++) {
+        selecionarTextoRegistros(componentes, n, sizeof(Componente), offsetof(Componente, chaveTipo),
+                                 chaveTipo, selecaoLinhas);
+        selecionarFaixaRegistros(componentes, n, sizeof(Componente), offsetof(Componente, prioridade),
+                                 minimo, maximo, condicao);
+        intersectarSelecao(selecaoLinhas, condicao, n);
+        selecionadosLinhas = contarSelecao(selecaoLinhas, n);
+    }
+    double tempoLinhas = (relogioParede() - inicio) / repeticoes;
+    
+    // Colunas: duas varreduras SSE2 de n bytes e um E de n / 64 palavras
+    int selecionadosColunas = 0;
+    inicio = relogioParede();
+    for (int r = 0; r < repeticoes; r++) {
+        selecionarIgualByte(tipoIds, n, (unsigned char)idBuscado, selecao);
+        selecionarFaixaByte(prioridades, n, (unsigned char)minimo, (unsigned char)maximo, condicao);
+        intersectarSelecao(selecao, condicao, n);
+        selecionadosColunas = contarSelecao(selecao, n);
+    }
+    double tempoColunas = (relogioParede() - inicio) / repeticoes;
+    int mesmoResultado = memcmp(selecaoLinhas, selecao, palavras * sizeof(unsigned long long)) == 0;
+    
+    printf("🔎 Consulta: tipo = propulsão E prioridade entre %d e %d\n", minimo, maximo);
+    printf("├─ Registros: %.3f ms (%d bytes por componente, strcmp do tipo)\n",
+           tempoLinhas * 1000, (int)sizeof(Componente));
+    printf("├─ Colunas: %.3f ms (2 bytes por componente, 16 por comparação)\n", tempoColunas * 1000);
+    printf("├─ Speedup: %.1fx\n", tempoColunas > 0 ? tempoLinhas / tempoColunas : 1.0);
+    printf("└─ Selecionados: %d de %d (registros: %d) %s\n\n", selecionadosColunas, n, selecionadosLinhas,
+           mesmoResultado ? "✅ (mesmos componentes)" : "❌ (seleções diferentes!)");
+    
+    // Só os primeiros selecionados vão para a tela
+    printf("Primeiros selecionados:\n");
+    imprimirCabecalhoTabela("Pos", "Prioridade");
+    int exibidos = 0;
+    for (int i = proximoSelecionado(selecao, n, 0); i != -1 && exibidos < 10; i = proximoSelecionado(selecao, n, i + 1)) {
+        imprimirLinhaTabela(i + 1, componentes[i].nome, componentes[i].tipo, componentes[i].prioridade);
+        exibidos++;
+    }
+    imprimirRodapeTabela();
+    printf("=============================================\n");
+    
+    free(componentes);
+    free(tipoIds);
+    free(prioridades);
+    free(selecaoLinhas);
+    free(selecao);
+    free(condicao);
+}
+
+/*
+ * ========================================
+ * BUSCA APROXIMADA (DISTÂNCIA DE EDIÇÃO)
+ * ========================================
+ */
+
+#define MAX_CANDIDATOS_APROXIMADOS 5
+
+/*
+ * Lista os componentes cujo nome está a poucas edições do nome digitado
+ * Varre torre inteira (ordem e cauda não importam aqui)
+ */
+void buscarNomeAproximado() {
+    if (totalComponentes == 0) {
+        printf("❌ Nenhum componente cadastrado!\n");
+        return;
+    }
+    
+    char nomeBusca[TAMANHO_NOME];
+    char chave[TAMANHO_NOME];
+    printf("Digite o nome (pode ter erros de digitação): ");
+    if (!lerTexto(nomeBusca, TAMANHO_NOME)) {
+        printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+        return;
+    }
+    normalizarTexto(nomeBusca, chave, TAMANHO_NOME);
+    
+    int limite = limitePadraoAproximado((int)strlen(chave));
+    CandidatoAproximado candidatos[MAX_CANDIDATOS_APROXIMADOS];
+    int total = buscarAproximados(torre, totalComponentes, sizeof(Componente), offsetof(Componente, chaveNome),
+                                  chave, limite, candidatos, MAX_CANDIDATOS_APROXIMADOS);
+    
+    if (total == 0) {
+        printf("❌ Nenhum componente a até %d edições de '%s'.\n", limite, nomeBusca);
+        return;
+    }
+    printf("🔎 Componentes a até %d edições de '%s':\n", limite, nomeBusca);
+    for (int c = 0; c < total; c++) {
+        const Componente* comp = &torre[candidatos[c].indice];
+        printf("%s %s (Tipo: %s, Prioridade: %d) — %d %s\n", c == total - 1 ? "└─" : "├─", comp->nome,
+               comp->tipo, comp->prioridade, candidatos[c].distancia,
+               candidatos[c].distancia == 1 ? "edição" : "edições");
+    }
+}
+
+/*
+ * Aplica até duas edições sorteadas (troca, remoção ou inserção) em texto
+ */
+static void introduzirErros(char texto[], int edicoes) {
+    for (int e = 0; e < edicoes; e++) {
+        int tamanho = (int)strlen(texto);
+        int posicao = rand() % (tamanho > 0 ? tamanho : 1);
+        char letra = (char)('a' + rand() % 26);
+        // Texto vazio: trocar ou apagar escreveriam sobre o terminador, só inserção serve
+        switch (tamanho > 0 ? rand() % 3 : 2) {
+            case 0:
+                texto[posicao] = letra;
+                break;
+            case 1:
+                memmove(texto + posicao, texto + posicao + 1, (size_t)(tamanho - posicao));
+                break;
+            default:
+                if (tamanho + 1 < TAMANHO_NOME) {
+                    memmove(texto + posicao + 1, texto + posicao, (size_t)(tamanho - posicao + 1));
+                    texto[posicao] = letra;
+                }
+                break;
+        }
+    }
+}
+
+/*
+ * Mede a busca aproximada em um inventário grande: nomes sorteados do próprio
+ * inventário recebem erros de digitação e são procurados com Myers; a
+ * primeira consulta também roda com a programação dinâmica comum, como referência
+ */
+void testarEscalaBuscaAproximada() {
+    const int consultas = 5;
+    int n;
+    
+    printf("=== TESTE DE ESCALA: BUSCA APROXIMADA ===\n");
+    printf("Quantidade de componentes (ex: 1000000): ");
+    scanf("%d", &n);
+    limparBuffer();
+    
+    if (n < 1) {
+        printf("❌ Parâmetros inválidos!\n");
+        return;
+    }
+    
+    Componente* componentes = (Componente*)malloc((size_t)n * sizeof(Componente));
+    if (componentes == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return;
+    }
+    printf("🔄 Gerando %d componentes aleatórios...\n\n", n);
+    gerarComponentesAleatorios(componentes, n);
+    
+    double tempoTotal = 0.0;
+    int acertos = 0;
+    for (int q = 0; q < consultas; q++) {
+        int alvo = rand() % n;
+        char chave[TAMANHO_NOME];
+        strcpy(chave, componentes[alvo].chaveNome);
+        introduzirErros(chave, 1 + q % 2);
+        int limite = limitePadraoAproximado((int)strlen(chave));
+        
+        CandidatoAproximado candidatos[MAX_CANDIDATOS_APROXIMADOS];
+        double inicio = relogioParede();
+        int total = buscarAproximados(componentes, n, sizeof(Componente), offsetof(Componente, chaveNome),
+                                      chave, limite, candidatos, MAX_CANDIDATOS_APROXIMADOS);
+        double tempo = relogioParede() - inicio;
+        tempoTotal += tempo;
+        
+        // O original pode empatar com outro nome à mesma distância
+        int encontrado = 0;
+        for (int c = 0; c < total; c++) {
+            encontrado |= strcmp(componentes[candidatos[c].indice].chaveNome, componentes[alvo].chaveNome) == 0;
+        }
+        acertos += encontrado;
+        
+        printf("🔎 '%s' (de '%s', limite %d):\n", chave, componentes[alvo].nome, limite);
+        printf("├─ Candidatos: %d | Melhor: %s (%d %s)\n", total,
+               total > 0 ? componentes[candidatos[0].indice].nome : "-", total > 0 ? candidatos[0].distancia : 0,
+               total > 0 && candidatos[0].distancia == 1 ? "edição" : "edições");
+        printf("├─ Original entre os candidatos: %s\n", encontrado ? "✅ sim" : "❌ não");
+        printf("└─ Myers bit-paralelo: %.3f ms\n", tempo * 1000);
+        
+        if (q == 0) {
+            // Referência: a mesma varredura com a programação dinâmica linha a linha
+            int encontradosDP = 0;
+            int tamanhoChave = (int)strlen(chave);
+            inicio = relogioParede();
+            for (int i = 0; i < n; i++) {
+                const char* nome = componentes[i].chaveNome;
+                encontradosDP += distanciaEdicao(chave, tamanhoChave, nome, (int)strlen(nome), limite) <= limite;
+            }
+            double tempoDP = relogioParede() - inicio;
+            printf("   Programação dinâmica: %.3f ms (%d nomes a até %d edições, %.1fx mais lenta)\n",
+                   tempoDP * 1000, encontradosDP, limite, tempo > 0 ? tempoDP / tempo : 0.0);
+        }
+        printf("\n");
+    }
+    
+    printf("📊 Tempo médio por consulta: %.3f ms em %d componentes | Originais encontrados: %d/%d\n",
+           tempoTotal / consultas * 1000, n, acertos, consultas);
+    printf("=============================================\n");
+    free(componentes);
+}
+
+/*
+ * ========================================
+ * BUSCA BINÁRIA E SISTEMA DE MONTAGEM
+ * ========================================
+ */
+
+/*
+ * Busca Binária - Busca por nome em array ordenado
+ * Complexidade: O(log n)
+ * Requer que o array esteja ordenado por nome
+ */
+int buscaBinariaPorNome(const Componente arr[], int n, const char nome[]) {
+    char chave[TAMANHO_NOME];
+    normalizarTexto(nome, chave, TAMANHO_NOME);
+    
+    int comparacoes = 0;
+    int indice = buscaBinariaContando(arr, n, chave, &comparacoes);
+    AMOSTRAR(metricaBusca, comparacoes);
+    return indice;
+}
+
+/*
+ * Busca binária que acumula as comparações no contador informado
+ * Leitores concorrentes passam um contador próprio em vez do global
+ * As funções ...Contando recebem o nome já normalizado (chaveNome)
+ */
+int buscaBinariaContando(const Componente arr[], int n, const char nome[], int* comparacoes) {
+    return buscaBinariaChave(arr, n, sizeof(Componente), offsetof(Componente, chaveNome),
+                             nome, comparacoes);
+}
+
+/*
+ * Busca sequencial na cauda: os últimos cauda itens de arr, ainda fora da
+ * ordem por nome. Retorna a posição em arr ou -1
+ */
+int buscaCaudaContando(const Componente arr[], int n, int cauda, const char nome[], int* comparacoes) {
+    int indice = buscaSequencialChave(arr + (n - cauda), cauda, sizeof(Componente),
+                                      offsetof(Componente, chaveNome), nome, comparacoes);
+    return indice != -1 ? n - cauda + indice : -1;
+}
+
+/*
+ * Tamanho do prefixo comum entre dois nomes
+ * Em um array ordenado, todos os nomes entre o primeiro e o último
+ * compartilham o prefixo comum desses dois
+ */
+static int prefixoComum(const char* a, const char* b) {
+    int i = 0;
+    while (a[i] != '\0' && a[i] == b[i]) {
+        i++;
+    }
+    return i;
+}
+
+/*
+ * Converte os 8 bytes do nome a partir de deslocamento em um número
+ * Os bytes entram do mais para o menos significativo (completando com zeros),
+ * então a ordem numérica é a mesma ordem do strcmp
+ * O nome precisa ter pelo menos deslocamento caracteres
+ */
+static unsigned long long chaveNumerica(const char* nome, int deslocamento) {
+    unsigned long long chave = 0;
+    int i = 0;
+    
+    nome += deslocamento;
+    for (; i < 8 && nome[i] != '\0'; i++) {
+        chave = (chave << 8) | (unsigned char)nome[i];
+    }
+    for (; i < 8; i++) {
+        chave <<= 8;
+    }
+    return chave;
+}
+
+/*
+ * Busca por Interpolação - Busca por nome em array ordenado
+ * Complexidade: O(log log n) com nomes uniformemente distribuídos, O(n) no pior caso
+ * Em vez de sempre testar o meio, estima a posição do nome pelo valor
+ * numérico dos seus primeiros caracteres (ignorando o prefixo que todos
+ * os nomes do array compartilham)
+ */
+int buscaInterpolacaoPorNome(const Componente arr[], int n, const char nome[]) {
+    char chave[TAMANHO_NOME];
+    normalizarTexto(nome, chave, TAMANHO_NOME);
+    
+    int comparacoes = 0;
+    int indice = buscaInterpolacaoContando(arr, n, chave, &comparacoes);
+    AMOSTRAR(metricaInterpolacao, comparacoes);
+    return indice;
+}
+
+int buscaInterpolacaoContando(const Componente arr[], int n, const char nome[], int* comparacoes) {
+    if (n == 0) {
+        return -1;
+    }
+    
+    // Nomes sem o prefixo comum estão fora do intervalo do array
+    int deslocamento = prefixoComum(arr[0].chaveNome, arr[n - 1].chaveNome);
+    CONTAR_LOCAL(*comparacoes);
+    if (strncmp(nome, arr[0].chaveNome, deslocamento) != 0) {
+        return -1;
+    }
+    
+    unsigned long long chave = chaveNumerica(nome, deslocamento);
+    int esquerda = 0;
+    int direita = n - 1;
+    
+    while (esquerda <= direita) {
+        unsigned long long chaveEsquerda = chaveNumerica(arr[esquerda].chaveNome, deslocamento);
+        unsigned long long chaveDireita = chaveNumerica(arr[direita].chaveNome, deslocamento);
+        
+        if (chave < chaveEsquerda || chave > chaveDireita) {
+            return -1; // Fora do intervalo restante
+        }
+        
+        int meio;
+        if (chaveDireita == chaveEsquerda) {
+            // Chaves iguais não dão informação para interpolar: usa o meio
+            meio = esquerda + (direita - esquerda) / 2;
+        } else {
+            double fracao = (double)(chave - chaveEsquerda) / (double)(chaveDireita - chaveEsquerda);
+            meio = esquerda + (int)(fracao * (direita - esquerda));
+            if (meio > direita) {
+                meio = direita;
+            }
+        }
+        
+        CONTAR_LOCAL(*comparacoes); // Conta cada comparação
+        int comparacao = strcmp(arr[meio].chaveNome, nome);
+        
+        if (comparacao == 0) {
+            return meio;
+        } else if (comparacao < 0) {
+            esquerda = meio + 1;
+        } else {
+            direita = meio - 1;
+        }
+    }
+    
+    return -1;
+}
+
+/*
+ * Busca Exponencial - Busca por nome em array ordenado
+ * Complexidade: O(log i), onde i é a posição do componente
+ * Dobra o limite (1, 2, 4, 8...) até passar do nome e então faz busca
+ * binária só nesse último intervalo; componentes no início são achados
+ * com poucas comparações
+ */
+int buscaExponencialPorNome(const Componente arr[], int n, const char nome[]) {
+    char chave[TAMANHO_NOME];
+    normalizarTexto(nome, chave, TAMANHO_NOME);
+    
+    int comparacoes = 0;
+    int indice = buscaExponencialContando(arr, n, chave, &comparacoes);
+    AMOSTRAR(metricaExponencial, comparacoes);
+    return indice;
+}
+
+int buscaExponencialContando(const Componente arr[], int n, const char nome[], int* comparacoes) {
+    if (n == 0) {
+        return -1;
+    }
+    
+    CONTAR_LOCAL(*comparacoes);
+    if (strcmp(arr[0].chaveNome, nome) == 0) {
+        return 0;
+    }
+    
+    int limite = 1;
+    while (limite < n) {
+        CONTAR_LOCAL(*comparacoes);
+        if (strcmp(arr[limite].chaveNome, nome) >= 0) {
+            break;
+        }
+        limite *= 2;
+    }
+    
+    int inicio = limite / 2;
+    int fim = limite < n ? limite + 1 : n;
+    int indice = buscaBinariaContando(arr + inicio, fim - inicio, nome, comparacoes);
+    
+    return indice == -1 ? -1 : inicio + indice;
+}
+
+/*
+ * Escolhe o algoritmo de busca pela distribuição dos nomes
+ * Amostra posições do array e mede o quanto a posição prevista pela
+ * interpolação se afasta da real: nomes uniformes ficam perto da reta e a
+ * interpolação acerta em poucas tentativas; caso contrário, busca binária
+ */
+AlgoritmoBusca escolherBusca(const Componente arr[], int n) {
+    if (n < 8) {
+        return BUSCA_BINARIA; // Com poucos nomes, log n já é mínimo
+    }
+    
+    int deslocamento = prefixoComum(arr[0].chaveNome, arr[n - 1].chaveNome);
+    unsigned long long primeira = chaveNumerica(arr[0].chaveNome, deslocamento);
+    unsigned long long ultima = chaveNumerica(arr[n - 1].chaveNome, deslocamento);
+    if (ultima == primeira) {
+        return BUSCA_BINARIA;
+    }
+    
+    int amostras = n < 64 ? n : 64;
+    double desvio = 0.0;
+    for (int k = 0; k < amostras; k++) {
+        int i = (int)((long long)k * (n - 1) / (amostras - 1));
+        double fracao = (double)(chaveNumerica(arr[i].chaveNome, deslocamento) - primeira) /
+                        (double)(ultima - primeira);
+        double erro = fracao * (n - 1) - i;
+        desvio += erro < 0 ? -erro : erro;
+    }
+    
+    // Erro médio de até 5% do tamanho do array
+    return desvio / amostras <= 0.05 * n ? BUSCA_INTERPOLACAO : BUSCA_BINARIA;
+}
+
+const char* nomeAlgoritmoBusca(AlgoritmoBusca algoritmo) {
+    switch (algoritmo) {
+        case BUSCA_INTERPOLACAO:
+            return "Busca por Interpolação";
+        case BUSCA_EXPONENCIAL:
+            return "Busca Exponencial";
+        default:
+            return "Busca Binária";
+    }
+}
+
+/*
+ * Sistema de montagem da torre de fuga
+ */
+void iniciarMontagem() {
+    printf("=== SISTEMA DE MONTAGEM DA TORRE ===\n");
+    
+    if (totalComponentes == 0) {
+        printf("❌ Nenhum componente cadastrado para montagem!\n");
+        return;
+    }
+    
+    printf("🏗️  Iniciando processo de montagem da torre de fuga...\n\n");
+    
+    // Verifica se há componentes de todos os tipos necessários
+    // Um tipo pode atender a mais de um sistema, então não usa as categorias
+    int sistemas = sistemasPresentes(&colunas);
+    int temControle = (sistemas >> CATEGORIA_CONTROLE) & 1;
+    int temSuporte = (sistemas >> CATEGORIA_SUPORTE) & 1;
+    int temPropulsao = (sistemas >> CATEGORIA_PROPULSAO) & 1;
+    
+    printf("📋 VERIFICAÇÃO DE COMPONENTES ESSENCIAIS:\n");
+    printf("├─ Sistema de Controle: %s\n", temControle ? "✅ Disponível" : "❌ Ausente");
+    printf("├─ Sistema de Suporte: %s\n", temSuporte ? "✅ Disponível" : "❌ Ausente");
+    printf("└─ Sistema de Propulsão: %s\n", temPropulsao ? "✅ Disponível" : "❌ Ausente");
+    
+    if (!temControle || !temSuporte || !temPropulsao) {
+        printf("\n⚠️  ATENÇÃO: Componentes essenciais estão faltando!\n");
+        printf("A torre pode não funcionar corretamente.\n");
+    }
+    
+    // Busca por componente-chave
+    printf("\n🔍 BUSCA DO COMPONENTE-CHAVE:\n");
+    
+    if (!ordenadoPorNome) {
+        printf("⚠️  Para localizar o componente-chave, é necessário ordenar por nome primeiro.\n");
+        printf("Deseja ordenar agora? (s/n): ");
+        
+        char resposta;
+        scanf(" %c", &resposta);
+        limparBuffer();
+        
+        if (resposta == 's' || resposta == 'S') {
+            printf("🔄 Ordenando componentes por nome...\n");
+            resetarContadores();
+            double tempo = medirTempo(bubbleSortNome, torre, totalComponentes);
+            ordenadoPorNome = 1;
+            caudaNome = 0;
+            ordenadoPorTipo = 0;
+            ordenadoPorPrioridade = 0;
+            publicarVersaoTorre();
+            printf("✅ Ordenação concluída em %.6f segundos\n", tempo);
+        } else {
+            printf("❌ Montagem cancelada. Ordene os componentes e tente novamente.\n");
+            return;
+        }
+    }
+    
+    char componenteChave[TAMANHO_NOME];
+    printf("Digite o nome do componente-chave para ativar a torre: ");
+    if (!lerTexto(componenteChave, TAMANHO_NOME)) {
+        printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+        return;
+    }
+    char chaveNormalizada[TAMANHO_NOME];
+    normalizarTexto(componenteChave, chaveNormalizada, TAMANHO_NOME);
+    
+    resetarContadores();
+    clock_t inicio = clock();
+    int indiceChave = -1;
+    if (consultarBloom(&filtroNomes, chaveNormalizada)) {
+        indiceChave = buscaBinariaPorNome(torre, totalComponentes - caudaNome, componenteChave);
+        if (indiceChave == -1 && caudaNome > 0) {
+            int comparacoesCauda = 0;
+            indiceChave = buscaCaudaContando(torre, totalComponentes, caudaNome, chaveNormalizada,
+                                             &comparacoesCauda);
+            SOMAR(metricaBusca, comparacoesCauda);
+        }
+        registrarResultadoBloom(&filtroNomes, indiceChave != -1);
+    }
+    clock_t fim = clock();
+    double tempoBusca = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+    
+    if (indiceChave == -1) {
+        printf("❌ FALHA NA MONTAGEM!\n");
+        printf("Componente-chave '%s' não encontrado.\n", componenteChave);
+        printf("Comparações realizadas: %llu | Tempo: %.6f segundos\n", lerMetrica(metricaBusca), tempoBusca);
+        return;
+    }
+    
+    printf("🎯 COMPONENTE-CHAVE LOCALIZADO!\n");
+    printf("Nome: %s\n", torre[indiceChave].nome);
+    printf("Tipo: %s\n", torre[indiceChave].tipo);
+    printf("Prioridade: %d\n", torre[indiceChave].prioridade);
+    printf("Localizado em %.6f segundos com %llu comparações\n", tempoBusca, lerMetrica(metricaBusca));
+    
+    // Simulação da montagem
+    printf("\n🏗️  INICIANDO MONTAGEM...\n");
+    
+    // Os componentes entram na montagem em ordem de prioridade, retirados um a
+    // um do heap, sem ordenar torre inteira antes
+    HeapMontagem heap;
+    construirHeapMontagem(&heap, torre, totalComponentes);
+    printf("📦 Fila de montagem por prioridade (heap %d-ário):\n", ARIDADE_HEAP);
+    for (int passo = 1; heap.total > 0; passo++) {
+        int indice = retirarHeapMontagem(&heap);
+        printf("│  %2d. %s (%s, prioridade %d)\n", passo,
+               torre[indice].nome, torre[indice].tipo, torre[indice].prioridade);
+    }
+    
+    printf("┌─ Fase 1: Instalando base de suporte...\n");
+    printf("├─ Fase 2: Conectando sistemas de controle...\n");
+    printf("├─ Fase 3: Ativando propulsão...\n");
+    printf("├─ Fase 4: Inserindo componente-chave...\n");
+    printf("└─ Fase 5: Teste final dos sistemas...\n");
+    
+    printf("\n🚀 TORRE DE FUGA MONTADA COM SUCESSO!\n");
+    printf("🎉 Parabéns! Você conseguiu escapar da ilha!\n");
+    
+    // Relatório final
+    printf("\n📊 RELATÓRIO FINAL DA MISSÃO:\n");
+    printf("├─ Componentes utilizados: %d\n", totalComponentes);
+    printf("├─ Algoritmo de ordenação: Bubble Sort\n");
+    printf("├─ Comparações na busca: %llu\n", lerMetrica(metricaBusca));
+    printf("├─ Comparações na fila de montagem: %llu\n", lerMetrica(metricaHeap));
+    printf("├─ Tempo de busca: %.6f segundos\n", tempoBusca);
+    printf("└─ Status da missão: ✅ SUCESSO\n");
+    
+    printf("=======================================\n");
+}
+
+/*
+ * Função para testar desempenho da busca binária vs sequencial
+ */
+void testarBuscas() {
+    if (totalComponentes == 0) {
+        printf("❌ Nenhum componente cadastrado para teste!\n");
+        return;
+    }
+    
+    printf("=== TESTE DE DESEMPENHO: BUSCAS SEQUENCIAL, BINÁRIA, INTERPOLAÇÃO E EXPONENCIAL ===\n");
+    
+    // Garante que está ordenado por nome para busca binária, sem cauda pendente
+    if (ordenadoPorNome && caudaNome > 0) {
+        printf("🔄 Intercalando a cauda de %d componentes no corpo ordenado...\n", caudaNome);
+        intercalarCaudaNome();
+        publicarVersaoTorre();
+    }
+    if (!ordenadoPorNome) {
+        printf("🔄 Ordenando por nome para habilitar busca binária...\n");
+        bubbleSortNome(torre, totalComponentes);
+        ordenadoPorNome = 1;
+        caudaNome = 0;
+        ordenadoPorTipo = 0;
+        ordenadoPorPrioridade = 0;
+        publicarVersaoTorre();
+    }
+    
+    // Escolhe um componente aleatório para buscar
+    int indiceAleatorio = rand() % totalComponentes;
+    char nomeBusca[TAMANHO_NOME];
+    strcpy(nomeBusca, torre[indiceAleatorio].nome);
+    
+    char chaveBusca[TAMANHO_NOME];
+    normalizarTexto(nomeBusca, chaveBusca, TAMANHO_NOME);
+    
+    printf("Testando busca pelo componente: '%s'\n\n", nomeBusca);
+    
+    // Teste de busca sequencial
+    printf("🔍 BUSCA SEQUENCIAL:\n");
+    int comparacoesSeq = 0;
+    clock_t inicioSeq = clock();
+    
+    int encontradoSeq = buscaSequencialChave(torre, totalComponentes, sizeof(Componente),
+                                             offsetof(Componente, chaveNome), chaveBusca,
+                                             &comparacoesSeq);
+    
+    clock_t fimSeq = clock();
+    double tempoSeq = ((double)(fimSeq - inicioSeq)) / CLOCKS_PER_SEC;
+    
+    printf("├─ Resultado: %s\n", encontradoSeq != -1 ? "Encontrado" : "Não encontrado");
+    printf("├─ Comparações: %d\n", comparacoesSeq);
+    printf("└─ Tempo: %.6f segundos\n\n", tempoSeq);
+    
+    // Teste de busca binária
+    printf("🎯 BUSCA BINÁRIA:\n");
+    resetarContadores();
+    clock_t inicioBin = clock();
+    int encontradoBin = buscaBinariaPorNome(torre, totalComponentes, nomeBusca);
+    clock_t fimBin = clock();
+    double tempoBin = ((double)(fimBin - inicioBin)) / CLOCKS_PER_SEC;
+    
+    int compBin = (int)lerMetrica(metricaBusca);
+    
+    printf("├─ Resultado: %s\n", encontradoBin != -1 ? "Encontrado" : "Não encontrado");
+    printf("├─ Comparações: %d\n", compBin);
+    printf("└─ Tempo: %.6f segundos\n\n", tempoBin);
+    
+    // Teste de busca por interpolação
+    printf("📐 BUSCA POR INTERPOLAÇÃO:\n");
+    resetarContadores();
+    clock_t inicioInt = clock();
+    int encontradoInt = buscaInterpolacaoPorNome(torre, totalComponentes, nomeBusca);
+    clock_t fimInt = clock();
+    double tempoInt = ((double)(fimInt - inicioInt)) / CLOCKS_PER_SEC;
+    int compInt = (int)lerMetrica(metricaInterpolacao);
+    
+    printf("├─ Resultado: %s\n", encontradoInt != -1 ? "Encontrado" : "Não encontrado");
+    printf("├─ Comparações: %d\n", compInt);
+    printf("└─ Tempo: %.6f segundos\n\n", tempoInt);
+    
+    // Teste de busca exponencial
+    printf("🚀 BUSCA EXPONENCIAL:\n");
+    resetarContadores();
+    clock_t inicioExp = clock();
+    int encontradoExp = buscaExponencialPorNome(torre, totalComponentes, nomeBusca);
+    clock_t fimExp = clock();
+    double tempoExp = ((double)(fimExp - inicioExp)) / CLOCKS_PER_SEC;
+    int compExp = (int)lerMetrica(metricaExponencial);
+    
+    printf("├─ Resultado: %s\n", encontradoExp != -1 ? "Encontrado" : "Não encontrado");
+    printf("├─ Comparações: %d\n", compExp);
+    printf("└─ Tempo: %.6f segundos\n\n", tempoExp);
+    
+    // Comparação
+    const char* vencedor = "Busca Sequencial";
+    int menor = comparacoesSeq;
+    if (compBin < menor) {
+        vencedor = "Busca Binária";
+        menor = compBin;
+    }
+    if (compInt < menor) {
+        vencedor = "Busca por Interpolação";
+        menor = compInt;
+    }
+    if (compExp < menor) {
+        vencedor = "Busca Exponencial";
+        menor = compExp;
+    }
+    
+    printf("📊 COMPARAÇÃO:\n");
+    printf("├─ Redução de comparações (binária): %.1f%%\n", 
+           (1.0 - (double)compBin / comparacoesSeq) * 100);
+    printf("├─ Speedup (binária): %.1fx mais rápida\n", 
+           tempoSeq > 0 && tempoBin > 0 ? tempoSeq / tempoBin : 1.0);
+    printf("├─ Recomendação automática para estes nomes: %s\n",
+           nomeAlgoritmoBusca(escolherBusca(torre, totalComponentes)));
+    printf("└─ Vencedor: %s (%d comparações)\n", vencedor, menor);
+    
+    printf("=============================================\n");
+}
+
+/*
+ * ========================================
+ * LEITURA CONCORRENTE (RCU POR ÉPOCAS)
+ * ========================================
+ */
+
+/*
+ * Aloca uma versão vazia com espaço para total componentes
+ */
+VersaoTorre* criarVersao(int total) {
+    VersaoTorre* versao = (VersaoTorre*)malloc(sizeof(VersaoTorre) + (size_t)total * sizeof(Componente));
+    if (versao == NULL) {
+        return NULL;
+    }
+    
+    versao->total = total;
+    versao->ordenadoPorNome = 0;
+    versao->caudaNome = 0;
+    versao->ordenadoPorTipo = 0;
+    versao->ordenadoPorPrioridade = 0;
+    for (int c = 0; c < TOTAL_CATEGORIAS; c++) {
+        versao->categorias[c] = 0;
+    }
+    versao->buscaRecomendada = BUSCA_BINARIA;
+    versao->proximaAposentada = NULL;
+    versao->epocaAposentadoria = 0;
+    return versao;
+}
+
+/*
+ * Libera as versões aposentadas que nenhum leitor ativo pode estar usando
+ * Um leitor que anunciou a época e pode ter lido qualquer versão aposentada
+ * em uma época >= e; versões aposentadas antes da menor época ativa são livres
+ * Deve ser chamada com mutexEscrita travado
+ */
+static void recolherVersoes() {
+    unsigned long long menorEpoca = EPOCA_INATIVA;
+    
+    for (int i = 0; i < MAX_LEITORES; i++) {
+        unsigned long long epoca = atomic_load(&slotsLeitores[i].epoca);
+        if (atomic_load(&slotsLeitores[i].ocupado) && epoca < menorEpoca) {
+            menorEpoca = epoca;
+        }
+    }
+    
+    VersaoTorre** atual = &versoesAposentadas;
+    while (*atual != NULL) {
+        if ((*atual)->epocaAposentadoria < menorEpoca) {
+            VersaoTorre* liberar = *atual;
+            *atual = liberar->proximaAposentada;
+            free(liberar);
+            versoesLiberadas++;
+        } else {
+            atual = &(*atual)->proximaAposentada;
+        }
+    }
+}
+
+/*
+ * Publica uma nova versão para os leitores
+ * A troca do ponteiro é atômica: cada leitor vê a versão antiga inteira ou a
+ * nova inteira, nunca uma mistura das duas. A versão antiga é aposentada na
+ * época atual e a época global avança
+ */
+void publicarVersao(VersaoTorre* nova) {
+    pthread_mutex_lock(&mutexEscrita);
+    
+    VersaoTorre* antiga = atomic_exchange(&versaoPublicada, nova);
+    unsigned long long epoca = atomic_fetch_add(&epocaGlobal, 1);
+    versoesPublicadas++;
+    
+    if (antiga != NULL) {
+        antiga->epocaAposentadoria = epoca;
+        antiga->proximaAposentada = versoesAposentadas;
+        versoesAposentadas = antiga;
+    }
+    recolherVersoes();
+    
+    pthread_mutex_unlock(&mutexEscrita);
+}
+
+/*
+ * Publica o estado atual de torre (chamada pelo escritor após cada alteração)
+ */
+void publicarVersaoTorre() {
+    VersaoTorre* versao = criarVersao(totalComponentes);
+    if (versao == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return;
+    }
+    
+    memcpy(versao->itens, torre, totalComponentes * sizeof(Componente));
+    versao->ordenadoPorNome = ordenadoPorNome;
+    versao->caudaNome = ordenadoPorNome ? caudaNome : 0;
+    versao->ordenadoPorTipo = ordenadoPorTipo;
+    versao->ordenadoPorPrioridade = ordenadoPorPrioridade;
+    contarCategorias(&colunas, versao->categorias);
+    if (ordenadoPorNome) {
+        versao->buscaRecomendada = escolherBusca(versao->itens, versao->total - versao->caudaNome);
+    }
+    
+    publicarVersao(versao);
+}
+
+/*
+ * Reserva um slot de leitor para a thread atual
+ * Só espera se todos os MAX_LEITORES slots estiverem em uso
+ */
+static void registrarLeitor() {
+    while (slotLeitorAtual == -1) {
+        for (int i = 0; i < MAX_LEITORES; i++) {
+            int livre = 0;
+            if (atomic_compare_exchange_strong(&slotsLeitores[i].ocupado, &livre, 1)) {
+                atomic_store(&slotsLeitores[i].epoca, EPOCA_INATIVA);
+                slotLeitorAtual = i;
+                return;
+            }
+        }
+        sched_yield();
+    }
+}
+
+/*
+ * Devolve o slot de leitor da thread atual (chamada ao fim de uma thread leitora)
+ */
+void liberarSlotLeitor() {
+    if (slotLeitorAtual != -1) {
+        atomic_store(&slotsLeitores[slotLeitorAtual].epoca, EPOCA_INATIVA);
+        atomic_store(&slotsLeitores[slotLeitorAtual].ocupado, 0);
+        slotLeitorAtual = -1;
+    }
+}
+
+/*
+ * Inicia uma leitura e retorna a versão publicada
+ * Não trava nada: apenas anuncia a época atual, o que impede que a versão
+ * lida seja liberada até sairLeitura
+ */
+const VersaoTorre* entrarLeitura() {
+    if (slotLeitorAtual == -1) {
+        registrarLeitor();
+    }
+    
+    atomic_store(&slotsLeitores[slotLeitorAtual].epoca, atomic_load(&epocaGlobal));
+    return atomic_load(&versaoPublicada);
+}
+
+/*
+ * Encerra a leitura; a versão retornada por entrarLeitura não pode mais ser usada
+ */
+void sairLeitura() {
+    atomic_store(&slotsLeitores[slotLeitorAtual].epoca, EPOCA_INATIVA);
+}
+
+// Estado de uma thread leitora da simulação
+typedef struct {
+    atomic_int* ativa;
+    unsigned int semente;
+    long leituras;
+    long falhas;        // Nomes publicados que a busca não encontrou
+    long comparacoes;
+} LeitorSimulado;
+
+static void* executarLeitor(void* arg) {
+    LeitorSimulado* leitor = (LeitorSimulado*)arg;
+    
+    while (atomic_load(leitor->ativa)) {
+        const VersaoTorre* versao = entrarLeitura();
+        
+        if (versao->total > 0 && versao->ordenadoPorNome) {
+            int comparacoes = 0;
+            int alvo = rand_r(&leitor->semente) % versao->total;
+            const char* chave = versao->itens[alvo].chaveNome;
+            int indice = buscaBinariaContando(versao->itens, versao->total - versao->caudaNome, chave, &comparacoes);
+            if (indice == -1) {
+                indice = buscaCaudaContando(versao->itens, versao->total, versao->caudaNome, chave, &comparacoes);
+            }
+            if (indice != alvo) {
+                leitor->falhas++;
+            }
+            leitor->comparacoes += comparacoes;
+        }
+        
+        sairLeitura();
+        leitor->leituras++;
+    }
+    
+    liberarSlotLeitor();
+    return NULL;
+}
+
+/*
+ * Simula o serviço da torre: várias threads fazem buscas binárias sem parar
+ * enquanto a thread principal cadastra componentes em ordem de nome,
+ * publicando uma nova versão a cada cadastro. Ao final, torre volta a ser a
+ * versão publicada
+ */
+void simularLeitoresConcorrentes() {
+    int numLeitores, insercoes;
+    
+    printf("=== SIMULAÇÃO DE LEITORES CONCORRENTES ===\n");
+    printf("Número de threads leitoras (1-%d): ", MAX_THREADS);
+    scanf("%d", &numLeitores);
+    limparBuffer();
+    printf("Quantidade de cadastros simulados (ex: 2000): ");
+    scanf("%d", &insercoes);
+    limparBuffer();
+    
+    if (numLeitores < 1 || numLeitores > MAX_THREADS || insercoes < 1) {
+        printf("❌ Parâmetros inválidos!\n");
+        return;
+    }
+    
+    // Versão inicial: componentes atuais ordenados por nome
+    VersaoTorre* atual = criarVersao(totalComponentes);
+    if (atual == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return;
+    }
+    memcpy(atual->itens, torre, totalComponentes * sizeof(Componente));
+    int comparacoesOrdenacao = 0;
+    Componente* aux = (Componente*)malloc((totalComponentes + 1) * sizeof(Componente));
+    if (aux != NULL) {
+        mergeSortIntervalo(atual->itens, aux, 0, totalComponentes, &comparacoesOrdenacao);
+        free(aux);
+    }
+    atual->ordenadoPorNome = aux != NULL;
+    
+    int publicadasAntes = versoesPublicadas;
+    int liberadasAntes = versoesLiberadas;
+    publicarVersao(atual);
+    
+    atomic_int ativa = 1;
+    pthread_t threads[MAX_THREADS];
+    int criada[MAX_THREADS];
+    LeitorSimulado leitores[MAX_THREADS];
+    
+    for (int t = 0; t < numLeitores; t++) {
+        leitores[t] = (LeitorSimulado){&ativa, (unsigned int)(t + 1) * 7919u, 0, 0, 0};
+        criada[t] = pthread_create(&threads[t], NULL, executarLeitor, &leitores[t]) == 0;
+    }
+    
+    printf("🔄 %d leitores ativos, cadastrando %d componentes...\n\n", numLeitores, insercoes);
+    
+    // Escritor: copia a versão atual, insere o novo nome na posição ordenada e publica
+    double inicio = relogioParede();
+    int cadastrados = 0;
+    for (int k = 0; k < insercoes; k++) {
+        Componente novo;
+        snprintf(novo.nome, TAMANHO_NOME, "simulado-%06d", k);
+        strcpy(novo.tipo, "outros");
+        novo.prioridade = PRIORIDADE_MIN + k % TOTAL_PRIORIDADES;
+        prepararChaves(&novo);
+        
+        VersaoTorre* nova = criarVersao(atual->total + 1);
+        if (nova == NULL) {
+            printf("❌ ERRO: Falha na alocação de memória!\n");
+            break;
+        }
+        
+        int posicao = 0;
+        while (posicao < atual->total && strcmp(atual->itens[posicao].chaveNome, novo.chaveNome) < 0) {
+            posicao++;
+        }
+        memcpy(nova->itens, atual->itens, posicao * sizeof(Componente));
+        nova->itens[posicao] = novo;
+        memcpy(&nova->itens[posicao + 1], &atual->itens[posicao],
+               (atual->total - posicao) * sizeof(Componente));
+        nova->ordenadoPorNome = atual->ordenadoPorNome;
+        
+        // atual continua válida para o escritor até ele mesmo publicar a próxima
+        publicarVersao(nova);
+        atual = nova;
+        cadastrados++;
+    }
+    double tempoEscrita = relogioParede() - inicio;
+    
+    atomic_store(&ativa, 0);
+    long leituras = 0, falhas = 0, comparacoes = 0;
+    for (int t = 0; t < numLeitores; t++) {
+        if (criada[t]) {
+            pthread_join(threads[t], NULL);
+        }
+        leituras += leitores[t].leituras;
+        falhas += leitores[t].falhas;
+        comparacoes += leitores[t].comparacoes;
+    }
+    double tempoTotal = relogioParede() - inicio;
+    
+    // Devolve aos leitores o estado real da torre
+    publicarVersaoTorre();
+    
+    printf("✍️  ESCRITOR:\n");
+    printf("├─ Cadastros publicados: %d\n", cadastrados);
+    printf("└─ Tempo médio por cadastro: %.6f segundos\n\n",
+           cadastrados > 0 ? tempoEscrita / cadastrados : 0.0);
+    
+    printf("📖 LEITORES:\n");
+    printf("├─ Buscas realizadas: %ld\n", leituras);
+    printf("├─ Buscas por segundo: %.0f\n", tempoTotal > 0 ? leituras / tempoTotal : 0.0);
+    printf("├─ Comparações médias por busca: %.1f\n", leituras > 0 ? (double)comparacoes / leituras : 0.0);
+    printf("└─ Buscas inconsistentes: %ld %s\n\n", falhas, falhas == 0 ? "✅" : "❌");
+    
+    printf("♻️  RECUPERAÇÃO DE MEMÓRIA:\n");
+    printf("├─ Versões publicadas: %d\n", versoesPublicadas - publicadasAntes);
+    printf("├─ Versões liberadas: %d\n", versoesLiberadas - liberadasAntes);
+    printf("└─ Versões aguardando liberação: %d\n",
+           versoesPublicadas - versoesLiberadas - 1);
+    printf("=============================================\n");
+}
+
+
+/*
+ * ========================================
+ * MONTAGEM PARALELA (GRAFO DE TAREFAS)
+ * ========================================
+ */
+
+// Nomes das fases, na ordem em que aparecem no iniciarMontagem
+static const char* nomesFases[TOTAL_FASES] = {
+    "Base de suporte", "Sistemas de controle", "Propulsão",
+    "Componente-chave", "Teste final"
+};
+
+// Grafo de tarefas de montagem
+// As tarefas são criadas em ordem topológica (toda dependência aponta para
+// uma tarefa criada depois), e os sucessores ficam em formato CSR:
+// os de t estão em sucessores[inicioSucessores[t] .. inicioSucessores[t + 1])
+typedef struct {
+    int total;
+    int capacidade;
+    int* fase;              // Fase da tarefa, -1 para nós de junção sem trabalho
+    int* custo;             // Prioridade do componente (0 nas junções)
+    atomic_int* pendentes;  // Predecessores ainda não concluídos
+    double* inicio;         // Instantes relativos ao começo da execução
+    double* fim;
+    double* duracao;        // Tempo de CPU da thread (ignora preempção)
+    
+    int totalArestas;
+    int capacidadeArestas;
+    int* arestaDe;
+    int* arestaPara;
+    int* inicioSucessores;
+    int* sucessores;
+    int semMemoria;         // Uma alocação falhou: as próximas adições são ignoradas
+} GrafoMontagem;
+
+// Fila de trabalho de uma thread: o dono empilha e desempilha na base (LIFO),
+// ladrões retiram do topo (FIFO), onde estão as tarefas mais antigas
+typedef struct {
+    int* tarefas;
+    int topo;
+    int base;
+    pthread_mutex_t trava;
+} DequeTrabalho;
+
+// Estado compartilhado da execução
+typedef struct {
+    GrafoMontagem* grafo;
+    DequeTrabalho* deques;
+    int numThreads;
+    atomic_int concluidas;
+    double instanteInicial;
+} ExecucaoMontagem;
+
+typedef struct {
+    ExecucaoMontagem* execucao;
+    int id;
+    unsigned int semente;
+    int executadas;
+    int roubos;
+} TrabalhadorMontagem;
+
+// Retorna o índice da tarefa, ou -1 (e liga semMemoria) se faltar memória
+static int adicionarTarefa(GrafoMontagem* g, int fase, int custo) {
+    if (g->semMemoria) {
+        return -1;
+    }
+    if (g->total == g->capacidade) {
+        int capacidade = g->capacidade ? g->capacidade * 2 : 64;
+        int* novaFase = realloc(g->fase, capacidade * sizeof(int));
+        if (novaFase != NULL) {
+            g->fase = novaFase;
+        }
+        int* novoCusto = realloc(g->custo, capacidade * sizeof(int));
+        if (novoCusto != NULL) {
+            g->custo = novoCusto;
+        }
+        if (novaFase == NULL || novoCusto == NULL) {
+            g->semMemoria = 1;
+            return -1;
+        }
+        g->capacidade = capacidade;
+    }
+    g->fase[g->total] = fase;
+    g->custo[g->total] = custo;
+    return g->total++;
+}
+
+static void adicionarDependencia(GrafoMontagem* g, int de, int para) {
+    if (g->semMemoria) {
+        return; // de ou para pode ser o -1 de uma tarefa que não coube
+    }
+    if (g->totalArestas == g->capacidadeArestas) {
+        int capacidade = g->capacidadeArestas ? g->capacidadeArestas * 2 : 64;
+        int* novoDe = realloc(g->arestaDe, capacidade * sizeof(int));
+        if (novoDe != NULL) {
+            g->arestaDe = novoDe;
+        }
+        int* novoPara = realloc(g->arestaPara, capacidade * sizeof(int));
+        if (novoPara != NULL) {
+            g->arestaPara = novoPara;
+        }
+        if (novoDe == NULL || novoPara == NULL) {
+            g->semMemoria = 1;
+            return;
+        }
+        g->capacidadeArestas = capacidade;
+    }
+    g->arestaDe[g->totalArestas] = de;
+    g->arestaPara[g->totalArestas] = para;
+    g->totalArestas++;
+}
+
+/*
+ * Monta o grafo de uma torre com os componentes de torre:
+ * suporte e outros -> base pronta -> controle e propulsão (independentes
+ * entre si) -> componente-chave -> teste final
+ * Retorna 0 se faltou memória
+ */
+static int adicionarTorreAoGrafo(GrafoMontagem* g) {
+    int baseInicio = g->total;
+    for (int i = 0; i < totalComponentes; i++) {
+        CategoriaTipo categoria = classificarTipo(torre[i].tipo);
+        if (categoria == CATEGORIA_SUPORTE || categoria == CATEGORIA_OUTROS) {
+            adicionarTarefa(g, 0, torre[i].prioridade);
+        }
+    }
+    int basePronta = adicionarTarefa(g, -1, 0);
+    for (int t = baseInicio; t < basePronta; t++) {
+        adicionarDependencia(g, t, basePronta);
+    }
     
-    // Restaura estado original
+    int sistemasInicio = g->total;
     for (int i = 0; i < totalComponentes; i++) {
-        torre[i] = original[i];
+        CategoriaTipo categoria = classificarTipo(torre[i].tipo);
+        if (categoria == CATEGORIA_CONTROLE) {
+            adicionarDependencia(g, basePronta, adicionarTarefa(g, 1, torre[i].prioridade));
+        } else if (categoria == CATEGORIA_PROPULSAO) {
+            adicionarDependencia(g, basePronta, adicionarTarefa(g, 2, torre[i].prioridade));
+        }
     }
+    int sistemasFim = g->total;
     
-    // Análise comparativa
-    printf("📊 ANÁLISE COMPARATIVA:\n");
+    int chave = adicionarTarefa(g, 3, PRIORIDADE_MAX);
+    if (sistemasFim == sistemasInicio) {
+        adicionarDependencia(g, basePronta, chave);
+    }
+    for (int t = sistemasInicio; t < sistemasFim; t++) {
+        adicionarDependencia(g, t, chave);
+    }
     
-    // Algoritmo mais rápido
-    if (tempoBubble <= tempoInsertion && tempoBubble <= tempoSelection) {
-        printf("🏆 Algoritmo mais rápido: Bubble Sort\n");
-    } else if (tempoInsertion <= tempoBubble && tempoInsertion <= tempoSelection) {
-        printf("🏆 Algoritmo mais rápido: Insertion Sort\n");
-    } else {
-        printf("🏆 Algoritmo mais rápido: Selection Sort\n");
+    adicionarDependencia(g, chave, adicionarTarefa(g, 4, PRIORIDADE_MAX));
+    return !g->semMemoria;
+}
+
+/*
+ * Converte a lista de arestas em CSR e conta os predecessores de cada tarefa
+ * Retorna 0 se faltou memória (liberarGrafo continua valendo)
+ */
+static int finalizarGrafo(GrafoMontagem* g) {
+    g->pendentes = malloc(g->total * sizeof(atomic_int));
+    g->inicio = calloc(g->total, sizeof(double));
+    g->fim = calloc(g->total, sizeof(double));
+    g->duracao = calloc(g->total, sizeof(double));
+    g->inicioSucessores = calloc(g->total + 1, sizeof(int));
+    g->sucessores = malloc((g->totalArestas + 1) * sizeof(int));
+    
+    int* predecessores = calloc(g->total, sizeof(int));
+    if (g->pendentes == NULL || g->inicio == NULL || g->fim == NULL || g->duracao == NULL ||
+        g->inicioSucessores == NULL || g->sucessores == NULL || predecessores == NULL) {
+        free(predecessores);
+        g->semMemoria = 1;
+        return 0;
+    }
+    for (int a = 0; a < g->totalArestas; a++) {
+        g->inicioSucessores[g->arestaDe[a] + 1]++;
+        predecessores[g->arestaPara[a]]++;
+    }
+    for (int t = 0; t < g->total; t++) {
+        g->inicioSucessores[t + 1] += g->inicioSucessores[t];
+        atomic_init(&g->pendentes[t], predecessores[t]);
     }
     
-    // Algoritmo com menos comparações
-    if (comparacoesBubble <= comparacoesInsertion && comparacoesBubble <= comparacoesSelection) {
-        printf("🎯 Menos comparações: Bubble Sort (%d)\n", comparacoesBubble);
-    } else if (comparacoesInsertion <= comparacoesBubble && comparacoesInsertion <= comparacoesSelection) {
-        printf("🎯 Menos comparações: Insertion Sort (%d)\n", comparacoesInsertion);
-    } else {
-        printf("🎯 Menos comparações: Selection Sort (%d)\n", comparacoesSelection);
+    // Reaproveita o vetor como cursor de escrita de cada tarefa
+    for (int t = 0; t < g->total; t++) {
+        predecessores[t] = g->inicioSucessores[t];
     }
-    
-    printf("\n💡 RECOMENDAÇÕES:\n");
-    printf("├─ Para dados quase ordenados: Insertion Sort\n");
-    printf("├─ Para dados pequenos: Qualquer algoritmo\n");
-    printf("├─ Para dados grandes: Considere algoritmos O(n log n)\n");
-    printf("└─ Para busca frequente: Ordene primeiro, depois use busca binária\n");
-    
-    printf("=============================================\n");
-    
-    // Reseta flags de ordenação
-    ordenadoPorNome = 0;
-    ordenadoPorTipo = 0;
-    ordenadoPorPrioridade = 0;
+    for (int a = 0; a < g->totalArestas; a++) {
+        g->sucessores[predecessores[g->arestaDe[a]]++] = g->arestaPara[a];
+    }
+    free(predecessores);
+    return 1;
 }
 
+static void liberarGrafo(GrafoMontagem* g) {
+    free(g->fase);
+    free(g->custo);
+    free(g->pendentes);
+    free(g->inicio);
+    free(g->fim);
+    free(g->duracao);
+    free(g->arestaDe);
+    free(g->arestaPara);
+    free(g->inicioSucessores);
+    free(g->sucessores);
+}
 
-/*
- * ========================================
- * BUSCA BINÁRIA E SISTEMA DE MONTAGEM
- * ========================================
- */
+static void empilharTarefa(DequeTrabalho* d, int tarefa) {
+    pthread_mutex_lock(&d->trava);
+    d->tarefas[d->base++] = tarefa;
+    pthread_mutex_unlock(&d->trava);
+}
+
+static int desempilharTarefa(DequeTrabalho* d) {
+    int tarefa = -1;
+    pthread_mutex_lock(&d->trava);
+    if (d->base > d->topo) {
+        tarefa = d->tarefas[--d->base];
+    }
+    pthread_mutex_unlock(&d->trava);
+    return tarefa;
+}
+
+static int roubarTarefa(DequeTrabalho* d) {
+    int tarefa = -1;
+    pthread_mutex_lock(&d->trava);
+    if (d->base > d->topo) {
+        tarefa = d->tarefas[d->topo++];
+    }
+    pthread_mutex_unlock(&d->trava);
+    return tarefa;
+}
 
 /*
- * Busca Binária - Busca por nome em array ordenado
- * Complexidade: O(log n)
- * Requer que o array esteja ordenado por nome
+ * Simula o trabalho de instalar um componente: custo proporcional à prioridade
  */
-int buscaBinariaPorNome(Componente arr[], int n, char nome[]) {
-    int esquerda = 0;
-    int direita = n - 1;
+static void executarTrabalho(int custo) {
+    volatile unsigned int estado = 1;
+    for (long k = 0; k < (long)custo * UNIDADE_TRABALHO; k++) {
+        estado = estado * 1103515245u + 12345u;
+    }
+}
+
+static double relogioThread() {
+    struct timespec agora;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &agora);
+    return agora.tv_sec + agora.tv_nsec / 1e9;
+}
+
+static void* executarTrabalhador(void* arg) {
+    TrabalhadorMontagem* trabalhador = (TrabalhadorMontagem*)arg;
+    ExecucaoMontagem* execucao = trabalhador->execucao;
+    GrafoMontagem* g = execucao->grafo;
+    DequeTrabalho* minhaFila = &execucao->deques[trabalhador->id];
     
-    while (esquerda <= direita) {
-        int meio = esquerda + (direita - esquerda) / 2;
-        comparacoesBusca++; // Conta cada comparação
+    while (atomic_load(&execucao->concluidas) < g->total) {
+        int tarefa = desempilharTarefa(minhaFila);
+        
+        // Fila vazia: tenta roubar das outras threads, começando por uma aleatória
+        if (tarefa == -1 && execucao->numThreads > 1) {
+            int vitima = rand_r(&trabalhador->semente) % execucao->numThreads;
+            for (int k = 0; k < execucao->numThreads && tarefa == -1; k++) {
+                int outra = (vitima + k) % execucao->numThreads;
+                if (outra != trabalhador->id) {
+                    tarefa = roubarTarefa(&execucao->deques[outra]);
+                }
+            }
+            if (tarefa != -1) {
+                trabalhador->roubos++;
+            }
+        }
         
-        int comparacao = strcmp(arr[meio].nome, nome);
+        if (tarefa == -1) {
+            sched_yield();
+            continue;
+        }
         
-        if (comparacao == 0) {
-            return meio; // Componente encontrado
-        } else if (comparacao < 0) {
-            esquerda = meio + 1; // Busca na metade direita
-        } else {
-            direita = meio - 1; // Busca na metade esquerda
+        g->inicio[tarefa] = relogioParede() - execucao->instanteInicial;
+        double cpuInicio = relogioThread();
+        executarTrabalho(g->custo[tarefa]);
+        g->duracao[tarefa] = relogioThread() - cpuInicio;
+        g->fim[tarefa] = relogioParede() - execucao->instanteInicial;
+        trabalhador->executadas++;
+        
+        // Libera os sucessores cuja última dependência era esta tarefa
+        for (int e = g->inicioSucessores[tarefa]; e < g->inicioSucessores[tarefa + 1]; e++) {
+            int sucessor = g->sucessores[e];
+            if (atomic_fetch_sub(&g->pendentes[sucessor], 1) == 1) {
+                empilharTarefa(minhaFila, sucessor);
+            }
         }
+        atomic_fetch_add(&execucao->concluidas, 1);
     }
     
-    return -1; // Componente não encontrado
+    return NULL;
 }
 
 /*
- * Sistema de montagem da torre de fuga
+ * Simula a montagem de várias torres ao mesmo tempo
+ * Cada componente vira uma tarefa e as fases viram dependências; tarefas
+ * independentes (controle e propulsão, ou torres diferentes) rodam em
+ * paralelo num conjunto de threads com roubo de trabalho
  */
-void iniciarMontagem() {
-    printf("=== SISTEMA DE MONTAGEM DA TORRE ===\n");
-    
+void simularMontagemParalela() {
     if (totalComponentes == 0) {
         printf("❌ Nenhum componente cadastrado para montagem!\n");
         return;
     }
     
-    printf("🏗️  Iniciando processo de montagem da torre de fuga...\n\n");
+    int numTorres, numThreads;
+    printf("=== MONTAGEM PARALELA (GRAFO DE TAREFAS) ===\n");
+    printf("Quantidade de torres a montar (1-%d, ex: 100): ", MAX_TORRES_MONTAGEM);
+    scanf("%d", &numTorres);
+    limparBuffer();
+    printf("Número de threads (1-%d): ", MAX_THREADS);
+    scanf("%d", &numThreads);
+    limparBuffer();
     
-    // Verifica se há componentes de todos os tipos necessários
-    int temControle = 0, temSuporte = 0, temPropulsao = 0;
+    if (numTorres < 1 || numTorres > MAX_TORRES_MONTAGEM || numThreads < 1 || numThreads > MAX_THREADS) {
+        printf("❌ Parâmetros inválidos!\n");
+        return;
+    }
     
-    for (int i = 0; i < totalComponentes; i++) {
-        if (strstr(torre[i].tipo, "controle") != NULL) temControle = 1;
-        if (strstr(torre[i].tipo, "suporte") != NULL) temSuporte = 1;
-        if (strstr(torre[i].tipo, "propulsão") != NULL || 
-            strstr(torre[i].tipo, "propulsao") != NULL) temPropulsao = 1;
+    GrafoMontagem grafo = {0};
+    int montado = 1;
+    for (int t = 0; t < numTorres && montado; t++) {
+        montado = adicionarTorreAoGrafo(&grafo);
+    }
+    if (!montado || !finalizarGrafo(&grafo)) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        liberarGrafo(&grafo);
+        return;
     }
     
-    printf("📋 VERIFICAÇÃO DE COMPONENTES ESSENCIAIS:\n");
-    printf("├─ Sistema de Controle: %s\n", temControle ? "✅ Disponível" : "❌ Ausente");
-    printf("├─ Sistema de Suporte: %s\n", temSuporte ? "✅ Disponível" : "❌ Ausente");
-    printf("└─ Sistema de Propulsão: %s\n", temPropulsao ? "✅ Disponível" : "❌ Ausente");
+    ExecucaoMontagem execucao;
+    execucao.grafo = &grafo;
+    execucao.numThreads = numThreads;
+    atomic_init(&execucao.concluidas, 0);
+    execucao.deques = calloc(numThreads, sizeof(DequeTrabalho));
+    double* terminoMaisCedo = calloc(grafo.total, sizeof(double));
+    int dequesProntos = execucao.deques != NULL && terminoMaisCedo != NULL;
+    for (int w = 0; w < numThreads && dequesProntos; w++) {
+        // Cada tarefa é empilhada uma única vez, então grafo.total basta
+        execucao.deques[w].tarefas = malloc(grafo.total * sizeof(int));
+        dequesProntos = execucao.deques[w].tarefas != NULL;
+    }
+    if (!dequesProntos) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        for (int w = 0; execucao.deques != NULL && w < numThreads; w++) {
+            free(execucao.deques[w].tarefas);
+        }
+        free(execucao.deques);
+        free(terminoMaisCedo);
+        liberarGrafo(&grafo);
+        return;
+    }
+    for (int w = 0; w < numThreads; w++) {
+        execucao.deques[w].topo = 0;
+        execucao.deques[w].base = 0;
+        pthread_mutex_init(&execucao.deques[w].trava, NULL);
+    }
     
-    if (!temControle || !temSuporte || !temPropulsao) {
-        printf("\n⚠️  ATENÇÃO: Componentes essenciais estão faltando!\n");
-        printf("A torre pode não funcionar corretamente.\n");
+    // Tarefas sem dependências começam distribuídas entre as threads
+    int prontas = 0;
+    for (int t = 0; t < grafo.total; t++) {
+        if (atomic_load(&grafo.pendentes[t]) == 0) {
+            empilharTarefa(&execucao.deques[prontas++ % numThreads], t);
+        }
     }
     
-    // Busca por componente-chave
-    printf("\n🔍 BUSCA DO COMPONENTE-CHAVE:\n");
+    printf("🔄 %d torres, %d tarefas, %d dependências, %d threads...\n\n",
+           numTorres, grafo.total, grafo.totalArestas, numThreads);
     
-    if (!ordenadoPorNome) {
-        printf("⚠️  Para localizar o componente-chave, é necessário ordenar por nome primeiro.\n");
-        printf("Deseja ordenar agora? (s/n): ");
-        
-        char resposta;
-        scanf(" %c", &resposta);
-        limparBuffer();
+    pthread_t threads[MAX_THREADS];
+    int criada[MAX_THREADS];
+    TrabalhadorMontagem trabalhadores[MAX_THREADS];
+    
+    execucao.instanteInicial = relogioParede();
+    for (int w = 0; w < numThreads; w++) {
+        trabalhadores[w] = (TrabalhadorMontagem){&execucao, w, (unsigned int)(w + 1) * 2654435761u, 0, 0};
+        criada[w] = pthread_create(&threads[w], NULL, executarTrabalhador, &trabalhadores[w]) == 0;
+    }
+    // Threads que não puderam ser criadas: a principal executa o trabalho delas
+    for (int w = 0; w < numThreads; w++) {
+        if (!criada[w]) {
+            executarTrabalhador(&trabalhadores[w]);
+        }
+    }
+    for (int w = 0; w < numThreads; w++) {
+        if (criada[w]) {
+            pthread_join(threads[w], NULL);
+        }
+    }
+    double tempoTotal = relogioParede() - execucao.instanteInicial;
+    
+    // Trabalho total e caminho crítico (maior soma de durações de uma cadeia
+    // de dependências), calculados na ordem topológica de criação
+    double trabalhoTotal = 0.0;
+    double caminhoCritico = 0.0;
+    double trabalhoFase[TOTAL_FASES] = {0};
+    double inicioFase[TOTAL_FASES], fimFase[TOTAL_FASES];
+    int tarefasFase[TOTAL_FASES] = {0};
+    
+    for (int f = 0; f < TOTAL_FASES; f++) {
+        inicioFase[f] = tempoTotal;
+        fimFase[f] = 0.0;
+    }
+    for (int t = 0; t < grafo.total; t++) {
+        double duracao = grafo.duracao[t];
+        trabalhoTotal += duracao;
+        terminoMaisCedo[t] += duracao;
+        if (terminoMaisCedo[t] > caminhoCritico) {
+            caminhoCritico = terminoMaisCedo[t];
+        }
+        for (int e = grafo.inicioSucessores[t]; e < grafo.inicioSucessores[t + 1]; e++) {
+            int sucessor = grafo.sucessores[e];
+            if (terminoMaisCedo[t] > terminoMaisCedo[sucessor]) {
+                terminoMaisCedo[sucessor] = terminoMaisCedo[t];
+            }
+        }
         
-        if (resposta == 's' || resposta == 'S') {
-            printf("🔄 Ordenando componentes por nome...\n");
-            resetarContadores();
-            double tempo = medirTempo(bubbleSortNome, torre, totalComponentes);
-            ordenadoPorNome = 1;
-            ordenadoPorTipo = 0;
-            ordenadoPorPrioridade = 0;
-            printf("✅ Ordenação concluída em %.6f segundos\n", tempo);
-        } else {
-            printf("❌ Montagem cancelada. Ordene os componentes e tente novamente.\n");
-            return;
+        int f = grafo.fase[t];
+        if (f >= 0) {
+            trabalhoFase[f] += duracao;
+            tarefasFase[f]++;
+            if (grafo.inicio[t] < inicioFase[f]) {
+                inicioFase[f] = grafo.inicio[t];
+            }
+            if (grafo.fim[t] > fimFase[f]) {
+                fimFase[f] = grafo.fim[t];
+            }
         }
     }
+    free(terminoMaisCedo);
     
-    char componenteChave[TAMANHO_NOME];
-    printf("Digite o nome do componente-chave para ativar a torre: ");
-    fgets(componenteChave, TAMANHO_NOME, stdin);
-    componenteChave[strcspn(componenteChave, "\n")] = 0;
+    printf("⏱️  DESEMPENHO:\n");
+    printf("├─ Tempo total: %.6f segundos\n", tempoTotal);
+    printf("├─ Trabalho total (soma das tarefas): %.6f segundos\n", trabalhoTotal);
+    printf("├─ Caminho crítico: %.6f segundos\n", caminhoCritico);
+    printf("├─ Paralelismo alcançado: %.2fx\n", tempoTotal > 0 ? trabalhoTotal / tempoTotal : 1.0);
+    printf("└─ Paralelismo disponível no grafo: %.2fx\n\n",
+           caminhoCritico > 0 ? trabalhoTotal / caminhoCritico : 1.0);
     
-    resetarContadores();
-    clock_t inicio = clock();
-    int indiceChave = buscaBinariaPorNome(torre, totalComponentes, componenteChave);
-    clock_t fim = clock();
-    double tempoBusca = ((double)(fim - inicio)) / CLOCKS_PER_SEC;
+    printf("📋 POR FASE:\n");
+    for (int f = 0; f < TOTAL_FASES; f++) {
+        printf("%s Fase %d (%s): %d tarefas | trabalho %.6f s | janela %.6f s\n",
+               f == TOTAL_FASES - 1 ? "└─" : "├─", f + 1, nomesFases[f], tarefasFase[f],
+               trabalhoFase[f], tarefasFase[f] > 0 ? fimFase[f] - inicioFase[f] : 0.0);
+    }
     
-    if (indiceChave == -1) {
-        printf("❌ FALHA NA MONTAGEM!\n");
-        printf("Componente-chave '%s' não encontrado.\n", componenteChave);
-        printf("Comparações realizadas: %d | Tempo: %.6f segundos\n", comparacoesBusca, tempoBusca);
-        return;
+    printf("\n🧵 POR THREAD:\n");
+    for (int w = 0; w < numThreads; w++) {
+        printf("%s Thread %d: %d tarefas, %d roubadas\n",
+               w == numThreads - 1 ? "└─" : "├─", w, trabalhadores[w].executadas, trabalhadores[w].roubos);
     }
+    printf("=============================================\n");
     
-    printf("🎯 COMPONENTE-CHAVE LOCALIZADO!\n");
-    printf("Nome: %s\n", torre[indiceChave].nome);
-    printf("Tipo: %s\n", torre[indiceChave].tipo);
-    printf("Prioridade: %d\n", torre[indiceChave].prioridade);
-    printf("Localizado em %.6f segundos com %d comparações\n", tempoBusca, comparacoesBusca);
+    for (int w = 0; w < numThreads; w++) {
+        pthread_mutex_destroy(&execucao.deques[w].trava);
+        free(execucao.deques[w].tarefas);
+    }
+    free(execucao.deques);
+    liberarGrafo(&grafo);
+}
+
+/*
+ * ========================================
+ * IMPORTAÇÃO EM LOTE (CSV/TSV)
+ * ========================================
+ */
+
+// Resultado da análise de uma linha do arquivo
+typedef enum {
+    LINHA_VALIDA,
+    LINHA_VAZIA,
+    LINHA_CAMPOS,       // Não tem exatamente nome, tipo e prioridade
+    LINHA_NOME,         // Nome vazio ou maior que TAMANHO_NOME - 1
+    LINHA_TIPO,         // Tipo vazio ou maior que TAMANHO_TIPO - 1
+    LINHA_PRIORIDADE,   // Prioridade fora de PRIORIDADE_MIN..PRIORIDADE_MAX
+    TOTAL_SITUACOES
+} SituacaoLinha;
+
+// Trecho do arquivo mapeado analisado por uma thread
+// Começa sempre no início de uma linha e termina logo depois de um '\n' (ou no fim do arquivo)
+// Todas as linhas são validadas, mas só as primeiras vagas com nome novo são guardadas:
+// a torre não recebe mais que isso, e a memória não cresce com o arquivo
+typedef struct {
+    const char* inicio;
+    const char* fim;
+    char separador;
+    int vagas;                                   // Vagas livres na torre no início da importação
+    Componente destino[MAX_COMPONENTES];         // Linhas guardadas, na ordem do arquivo
+    unsigned long long hashes[MAX_COMPONENTES];  // Hash da chave de cada linha guardada
+    int guardadas;
+    long linhas;
+    long duplicatas;              // Repetições de um nome já guardado no trecho
+    long jaCadastrados;           // Nomes que já estavam na torre
+    long situacoes[TOTAL_SITUACOES];
+} TrechoImportacao;
+
+// Remove espaços nas pontas de um campo [*inicio, *fim)
+static void aparaCampo(const char** inicio, const char** fim) {
+    while (*inicio < *fim && (**inicio == ' ' || **inicio == '\t')) {
+        (*inicio)++;
+    }
+    while (*fim > *inicio && ((*fim)[-1] == ' ' || (*fim)[-1] == '\t' || (*fim)[-1] == '\r')) {
+        (*fim)--;
+    }
+}
+
+/*
+ * Valida uma linha com nome, tipo e prioridade usando as mesmas regras do
+ * cadastro e, se for válida, preenche o componente (inclusive as chaves)
+ */
+static SituacaoLinha analisarLinha(const char* inicio, const char* fim, char separador, Componente* c) {
+    const char* campos[3];
+    const char* finais[3];
+    int total = 0;
     
-    // Simulação da montagem
-    printf("\n🏗️  INICIANDO MONTAGEM...\n");
-    printf("┌─ Fase 1: Instalando base de suporte...\n");
-    printf("├─ Fase 2: Conectando sistemas de controle...\n");
-    printf("├─ Fase 3: Ativando propulsão...\n");
-    printf("├─ Fase 4: Inserindo componente-chave...\n");
-    printf("└─ Fase 5: Teste final dos sistemas...\n");
+    aparaCampo(&inicio, &fim);
+    if (inicio == fim) {
+        return LINHA_VAZIA;
+    }
     
-    printf("\n🚀 TORRE DE FUGA MONTADA COM SUCESSO!\n");
-    printf("🎉 Parabéns! Você conseguiu escapar da ilha!\n");
+    const char* p = inicio;
+    while (total < 3) {
+        const char* separadorAchado = memchr(p, separador, fim - p);
+        campos[total] = p;
+        finais[total] = separadorAchado != NULL ? separadorAchado : fim;
+        total++;
+        if (separadorAchado == NULL) {
+            break;
+        }
+        p = separadorAchado + 1;
+    }
+    if (total != 3 || memchr(campos[2], separador, fim - campos[2]) != NULL) {
+        return LINHA_CAMPOS;
+    }
+    for (int i = 0; i < 3; i++) {
+        aparaCampo(&campos[i], &finais[i]);
+    }
     
-    // Relatório final
-    printf("\n📊 RELATÓRIO FINAL DA MISSÃO:\n");
-    printf("├─ Componentes utilizados: %d\n", totalComponentes);
-    printf("├─ Algoritmo de ordenação: Bubble Sort\n");
-    printf("├─ Comparações na busca: %d\n", comparacoesBusca);
-    printf("├─ Tempo de busca: %.6f segundos\n", tempoBusca);
-    printf("└─ Status da missão: ✅ SUCESSO\n");
+    long tamanhoNome = finais[0] - campos[0];
+    long tamanhoTipo = finais[1] - campos[1];
+    if (tamanhoNome == 0 || tamanhoNome >= TAMANHO_NOME) {
+        return LINHA_NOME;
+    }
+    if (tamanhoTipo == 0 || tamanhoTipo >= TAMANHO_TIPO) {
+        return LINHA_TIPO;
+    }
     
-    printf("=======================================\n");
+    int prioridade = 0;
+    if (campos[2] == finais[2] || finais[2] - campos[2] > 2) {
+        return LINHA_PRIORIDADE;
+    }
+    for (p = campos[2]; p < finais[2]; p++) {
+        if (*p < '0' || *p > '9') {
+            return LINHA_PRIORIDADE;
+        }
+        prioridade = prioridade * 10 + (*p - '0');
+    }
+    if (prioridade < PRIORIDADE_MIN || prioridade > PRIORIDADE_MAX) {
+        return LINHA_PRIORIDADE;
+    }
+    
+    memcpy(c->nome, campos[0], tamanhoNome);
+    c->nome[tamanhoNome] = '\0';
+    memcpy(c->tipo, campos[1], tamanhoTipo);
+    c->tipo[tamanhoTipo] = '\0';
+    c->prioridade = prioridade;
+    prepararChaves(c);
+    return LINHA_VALIDA;
 }
 
 /*
- * Função para testar desempenho da busca binária vs sequencial
+ * Valida as linhas do trecho e guarda as primeiras vagas com nome novo
+ * Depois que o trecho enche, as linhas restantes só entram nas contagens
+ * A árvore radix só é lida aqui: a thread principal espera as análises
  */
-void testarBuscas() {
-    if (totalComponentes == 0) {
-        printf("❌ Nenhum componente cadastrado para teste!\n");
+static void* analisarTrecho(void* arg) {
+    TrechoImportacao* t = (TrechoImportacao*)arg;
+    const char* p = t->inicio;
+    Componente c;
+    
+    t->guardadas = 0;
+    t->linhas = 0;
+    t->duplicatas = 0;
+    t->jaCadastrados = 0;
+    memset(t->situacoes, 0, sizeof(t->situacoes));
+    while (p < t->fim) {
+        const char* quebra = memchr(p, '\n', t->fim - p);
+        const char* fimLinha = quebra != NULL ? quebra : t->fim;
+        
+        SituacaoLinha situacao = analisarLinha(p, fimLinha, t->separador, &c);
+        t->linhas++;
+        t->situacoes[situacao]++;
+        p = fimLinha + 1;
+        if (situacao != LINHA_VALIDA || t->guardadas == t->vagas) {
+            continue;
+        }
+        
+        if (buscarRadix(&arvoreNomes, c.chaveNome) != RADIX_SEM_VALOR) {
+            t->jaCadastrados++;
+            continue;
+        }
+        unsigned long long hash = hashNome(c.chaveNome);
+        int repetida = 0;
+        for (int g = 0; g < t->guardadas && !repetida; g++) {
+            repetida = t->hashes[g] == hash && strcmp(t->destino[g].chaveNome, c.chaveNome) == 0;
+        }
+        if (repetida) {
+            t->duplicatas++;
+        } else {
+            t->hashes[t->guardadas] = hash;
+            t->destino[t->guardadas++] = c;
+        }
+    }
+    return NULL;
+}
+
+// Cria numThreads threads com a função; sem thread disponível, executa na atual
+static void executarEmParalelo(void* (*funcao)(void*), void* argumentos, size_t tamanho, int numThreads) {
+    pthread_t threads[MAX_THREADS];
+    int criada[MAX_THREADS];
+    
+    for (int t = 0; t < numThreads; t++) {
+        void* argumento = (char*)argumentos + t * tamanho;
+        criada[t] = pthread_create(&threads[t], NULL, funcao, argumento) == 0;
+        if (!criada[t]) {
+            funcao(argumento);
+        }
+    }
+    for (int t = 0; t < numThreads; t++) {
+        if (criada[t]) {
+            pthread_join(threads[t], NULL);
+        }
+    }
+}
+
+/*
+ * Importa componentes de um arquivo CSV (vírgula) ou TSV (tabulação) com
+ * as colunas nome, tipo e prioridade; uma primeira linha sem prioridade
+ * numérica é tratada como cabeçalho. Campos entre aspas não são suportados.
+ *
+ * O arquivo é mapeado em memória e dividido em trechos, analisados em
+ * paralelo: cada thread valida todas as linhas do seu trecho e guarda só as
+ * primeiras com nome novo, até o número de vagas da torre. Os trechos são
+ * então percorridos na ordem do arquivo, as repetições entre trechos são
+ * descartadas, e os componentes entram na torre com os índices atualizados
+ * uma única vez. Duplicatas e nomes já cadastrados só são contados entre as
+ * linhas examinadas antes de o trecho encher.
+ */
+void importarComponentes() {
+    char caminho[256];
+    int numThreads;
+    
+    printf("=== IMPORTAR COMPONENTES (CSV/TSV) ===\n");
+    printf("Arquivo (colunas nome, tipo, prioridade): ");
+    fgets(caminho, sizeof(caminho), stdin);
+    caminho[strcspn(caminho, "\n")] = 0;
+    printf("Número de threads (1-%d): ", MAX_THREADS);
+    scanf("%d", &numThreads);
+    limparBuffer();
+    if (numThreads < 1 || numThreads > MAX_THREADS) {
+        printf("❌ Número de threads inválido!\n");
+        return;
+    }
+    int vagas = MAX_COMPONENTES - totalComponentes;
+    if (vagas == 0) {
+        printf("❌ A torre está cheia (limite %d)!\n", MAX_COMPONENTES);
         return;
     }
     
-    printf("=== TESTE DE DESEMPENHO: BUSCA SEQUENCIAL vs BINÁRIA ===\n");
+    double inicio = relogioParede();
+    int arquivo = open(caminho, O_RDONLY);
+    if (arquivo < 0) {
+        printf("❌ ERRO: Não foi possível abrir '%s'!\n", caminho);
+        return;
+    }
+    struct stat info;
+    if (fstat(arquivo, &info) != 0 || info.st_size == 0) {
+        printf("❌ ERRO: Arquivo vazio ou ilegível!\n");
+        close(arquivo);
+        return;
+    }
+    size_t tamanho = (size_t)info.st_size;
+    const char* mapa = (const char*)mmap(NULL, tamanho, PROT_READ, MAP_PRIVATE, arquivo, 0);
+    close(arquivo);
+    if (mapa == MAP_FAILED) {
+        printf("❌ ERRO: Falha ao mapear o arquivo!\n");
+        return;
+    }
+    madvise((void*)mapa, tamanho, MADV_SEQUENTIAL);
+    const char* fimArquivo = mapa + tamanho;
     
-    // Garante que está ordenado por nome para busca binária
-    if (!ordenadoPorNome) {
-        printf("🔄 Ordenando por nome para habilitar busca binária...\n");
-        bubbleSortNome(torre, totalComponentes);
-        ordenadoPorNome = 1;
+    // O separador e o cabeçalho vêm da primeira linha
+    const char* fimPrimeira = memchr(mapa, '\n', tamanho);
+    if (fimPrimeira == NULL) {
+        fimPrimeira = fimArquivo;
+    }
+    char separador = memchr(mapa, '\t', fimPrimeira - mapa) != NULL ? '\t' : ',';
+    const char* ultimoCampo = fimPrimeira;
+    while (ultimoCampo > mapa && ultimoCampo[-1] != separador) {
+        ultimoCampo--;
+    }
+    while (ultimoCampo < fimPrimeira && *ultimoCampo == ' ') {
+        ultimoCampo++;
+    }
+    int cabecalho = ultimoCampo == fimPrimeira || *ultimoCampo < '0' || *ultimoCampo > '9';
+    const char* dados = mapa;
+    if (cabecalho) {
+        dados = fimPrimeira < fimArquivo ? fimPrimeira + 1 : fimArquivo;
     }
     
-    // Escolhe um componente aleatório para buscar
-    int indiceAleatorio = rand() % totalComponentes;
-    char nomeBusca[TAMANHO_NOME];
-    strcpy(nomeBusca, torre[indiceAleatorio].nome);
+    // Trechos de tamanhos parecidos, com as bordas avançadas até o início de uma linha
+    TrechoImportacao trechos[MAX_THREADS];
+    size_t bytesDados = fimArquivo - dados;
+    for (int t = 0; t < numThreads; t++) {
+        const char* borda = dados + bytesDados * t / numThreads;
+        if (t > 0) {
+            if (borda < trechos[t - 1].inicio) {
+                borda = trechos[t - 1].inicio;
+            }
+            while (borda > dados && borda < fimArquivo && borda[-1] != '\n') {
+                borda++;
+            }
+            trechos[t - 1].fim = borda;
+        }
+        trechos[t].inicio = borda;
+        trechos[t].fim = fimArquivo;
+        trechos[t].separador = separador;
+        trechos[t].vagas = vagas;
+    }
     
-    printf("Testando busca pelo componente: '%s'\n\n", nomeBusca);
+    // Validação e conversão, com as primeiras linhas novas de cada trecho guardadas
+    executarEmParalelo(analisarTrecho, trechos, sizeof(TrechoImportacao), numThreads);
+    double fimAnalise = relogioParede();
+    munmap((void*)mapa, tamanho);
     
-    // Teste de busca sequencial
-    printf("🔍 BUSCA SEQUENCIAL:\n");
-    int comparacoesSeq = 0;
-    clock_t inicioSeq = clock();
+    long totalLinhas = 0;
+    long duplicatasArquivo = 0;
+    long jaCadastrados = 0;
+    long situacoes[TOTAL_SITUACOES] = {0};
+    for (int t = 0; t < numThreads; t++) {
+        totalLinhas += trechos[t].linhas;
+        duplicatasArquivo += trechos[t].duplicatas;
+        jaCadastrados += trechos[t].jaCadastrados;
+        for (int s = 0; s < TOTAL_SITUACOES; s++) {
+            situacoes[s] += trechos[t].situacoes[s];
+        }
+    }
     
-    int encontradoSeq = -1;
-    for (int i = 0; i < totalComponentes; i++) {
-        comparacoesSeq++;
-        if (strcmp(torre[i].nome, nomeBusca) == 0) {
-            encontradoSeq = i;
-            break;
+    // Inclusão na torre, na ordem do arquivo, e publicação única
+    // Os trechos já descartaram os nomes cadastrados antes: um nome que agora
+    // está na árvore veio de um trecho anterior
+    int incluidos = 0;
+    for (int t = 0; t < numThreads; t++) {
+        for (int g = 0; g < trechos[t].guardadas && totalComponentes < MAX_COMPONENTES; g++) {
+            const Componente* c = &trechos[t].destino[g];
+            if (buscarRadix(&arvoreNomes, c->chaveNome) != RADIX_SEM_VALOR) {
+                duplicatasArquivo++;
+                continue;
+            }
+            torre[totalComponentes++] = *c;
+            adicionarColunar(&colunas, c);
+            adicionarBloom(&filtroNomes, c->chaveNome);
+            inserirRadix(&arvoreNomes, c->chaveNome, colunas.total - 1);
+            incluidos++;
         }
     }
+    if (incluidos > 0) {
+        ordenadoPorNome = 0;
+        caudaNome = 0;
+        ordenadoPorTipo = 0;
+        ordenadoPorPrioridade = 0;
+        publicarVersaoTorre();
+    }
+    long semEspaco = situacoes[LINHA_VALIDA] - incluidos - duplicatasArquivo - jaCadastrados;
+    double fim = relogioParede();
     
-    clock_t fimSeq = clock();
-    double tempoSeq = ((double)(fimSeq - inicioSeq)) / CLOCKS_PER_SEC;
+    SOMAR(metricaImportadas, situacoes[LINHA_VALIDA]);
+    SOMAR(metricaRejeitadas, totalLinhas - situacoes[LINHA_VALIDA] - situacoes[LINHA_VAZIA]);
     
-    printf("├─ Resultado: %s\n", encontradoSeq != -1 ? "Encontrado" : "Não encontrado");
-    printf("├─ Comparações: %d\n", comparacoesSeq);
-    printf("└─ Tempo: %.6f segundos\n\n", tempoSeq);
+    printf("\n📥 ARQUIVO: %s (%s, %.1f MB%s)\n", caminho, separador == '\t' ? "TSV" : "CSV",
+           tamanho / (1024.0 * 1024.0), cabecalho ? ", com cabeçalho" : "");
+    printf("├─ Linhas: %ld\n", totalLinhas);
+    printf("├─ Válidas: %ld\n", situacoes[LINHA_VALIDA]);
+    printf("├─ Vazias: %ld\n", situacoes[LINHA_VAZIA]);
+    printf("├─ Rejeitadas: %ld campos, %ld nome, %ld tipo, %ld prioridade\n",
+           situacoes[LINHA_CAMPOS], situacoes[LINHA_NOME], situacoes[LINHA_TIPO], situacoes[LINHA_PRIORIDADE]);
+    printf("├─ Duplicadas no arquivo: %ld\n", duplicatasArquivo);
+    printf("├─ Já cadastradas na torre: %ld\n", jaCadastrados);
+    printf("├─ Sem espaço na torre (limite %d): %ld\n", MAX_COMPONENTES, semEspaco);
+    printf("└─ Incluídas: %d\n\n", incluidos);
     
-    // Teste de busca binária
-    printf("🎯 BUSCA BINÁRIA:\n");
-    resetarContadores();
-    clock_t inicioBin = clock();
-    int encontradoBin = buscaBinariaPorNome(torre, totalComponentes, nomeBusca);
-    clock_t fimBin = clock();
-    double tempoBin = ((double)(fimBin - inicioBin)) / CLOCKS_PER_SEC;
+    double tempoTotal = fim - inicio;
+    printf("⏱️  TEMPO (%d threads):\n", numThreads);
+    printf("├─ Mapeamento e análise: %.6f segundos\n", fimAnalise - inicio);
+    printf("├─ Inclusão e índices: %.6f segundos\n", fim - fimAnalise);
+    printf("└─ Total: %.6f segundos (%.0f linhas/s)\n", tempoTotal,
+           tempoTotal > 0 ? totalLinhas / tempoTotal : 0.0);
+}
+
+/*
+ * Gera um arquivo CSV com componentes aleatórios para testar a importação
+ * Nomes repetidos aparecem naturalmente, e cerca de 1% das linhas é inválida
+ */
+void gerarArquivoImportacao() {
+    char caminho[256];
+    long n;
     
-    printf("├─ Resultado: %s\n", encontradoBin != -1 ? "Encontrado" : "Não encontrado");
-    printf("├─ Comparações: %d\n", comparacoesBusca);
-    printf("└─ Tempo: %.6f segundos\n\n", tempoBin);
+    printf("=== GERAR ARQUIVO DE IMPORTAÇÃO ===\n");
+    printf("Arquivo de saída: ");
+    fgets(caminho, sizeof(caminho), stdin);
+    caminho[strcspn(caminho, "\n")] = 0;
+    printf("Quantidade de linhas (ex: 10000000): ");
+    scanf("%ld", &n);
+    limparBuffer();
+    if (n < 1) {
+        printf("❌ Quantidade inválida!\n");
+        return;
+    }
     
-    // Comparação
-    printf("📊 COMPARAÇÃO:\n");
-    printf("├─ Redução de comparações: %.1f%%\n", 
-           (1.0 - (double)comparacoesBusca / comparacoesSeq) * 100);
-    printf("├─ Speedup: %.1fx mais rápida\n", 
-           tempoSeq > 0 ? tempoSeq / tempoBin : 1.0);
-    printf("└─ Vencedor: %s\n", 
-           comparacoesBusca < comparacoesSeq ? "Busca Binária" : "Busca Sequencial");
+    FILE* arquivo = fopen(caminho, "w");
+    if (arquivo == NULL) {
+        printf("❌ ERRO: Não foi possível criar '%s'!\n", caminho);
+        return;
+    }
     
-    printf("=============================================\n");
-}
\ No newline at end of file
+    double inicio = relogioParede();
+    fprintf(arquivo, "nome,tipo,prioridade\n");
+    for (long i = 0; i < n; i++) {
+        int prioridade = PRIORIDADE_MIN + rand() % TOTAL_PRIORIDADES;
+        if (rand() % 100 == 0) {
+            prioridade = PRIORIDADE_MAX + 1; // Linha inválida de propósito
+        }
+        fprintf(arquivo, "componente-%08d,%s,%d\n", rand() % 100000000,
+                tiposGerados[rand() % TOTAL_TIPOS_GERADOS], prioridade);
+    }
+    fclose(arquivo);
+    
+    printf("✅ %ld linhas gravadas em %s (%.6f segundos)\n", n, caminho, relogioParede() - inicio);
+}
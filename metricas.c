@@ -0,0 +1,180 @@
+/*
+ * Registro de Métricas de Instrumentação - implementação (veja metricas.h)
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "metricas.h"
+
+// Valores de uma thread; em histogramas, valores[] guarda a soma das amostras
+typedef struct {
+    _Alignas(64) _Atomic unsigned long long valores[MAX_METRICAS];
+    _Atomic unsigned long long baldes[MAX_METRICAS][BALDES_HISTOGRAMA];
+    atomic_int ocupada;
+} FatiaMetricas;
+
+static char nomesMetricas[MAX_METRICAS][TAMANHO_NOME_METRICA];
+static TipoMetrica tiposMetricas[MAX_METRICAS];
+static int totalMetricas = 0;
+
+// A última fatia é a compartilhada, atualizada com soma atômica
+static FatiaMetricas fatiasMetricas[MAX_FATIAS + 1];
+static SnapshotMetricas linhaBaseMetricas;  // Referência do último zerarMetricas()
+
+static _Thread_local FatiaMetricas* fatiaLocal = NULL;
+static pthread_key_t chaveFatia;
+static pthread_once_t fatiaInicializada = PTHREAD_ONCE_INIT;
+
+/*
+ * Registra uma métrica e retorna seu identificador (-1 se o registro estiver cheio)
+ */
+int registrarMetrica(const char* nome, TipoMetrica tipo) {
+    if (totalMetricas == MAX_METRICAS) {
+        return -1;
+    }
+    strncpy(nomesMetricas[totalMetricas], nome, TAMANHO_NOME_METRICA - 1);
+    tiposMetricas[totalMetricas] = tipo;
+    return totalMetricas++;
+}
+
+// Devolve a fatia quando a thread termina; os valores permanecem nela
+static void liberarFatia(void* fatia) {
+    atomic_store(&((FatiaMetricas*)fatia)->ocupada, 0);
+}
+
+static void criarChaveFatia() {
+    pthread_key_create(&chaveFatia, liberarFatia);
+}
+
+static FatiaMetricas* reservarFatia() {
+    pthread_once(&fatiaInicializada, criarChaveFatia);
+    for (int i = 0; i < MAX_FATIAS; i++) {
+        int livre = 0;
+        if (atomic_compare_exchange_strong(&fatiasMetricas[i].ocupada, &livre, 1)) {
+            pthread_setspecific(chaveFatia, &fatiasMetricas[i]);
+            return &fatiasMetricas[i];
+        }
+    }
+    return &fatiasMetricas[MAX_FATIAS];
+}
+
+static void somarValor(FatiaMetricas* fatia, _Atomic unsigned long long* campo,
+                       unsigned long long valor) {
+    if (fatia == &fatiasMetricas[MAX_FATIAS]) {
+        atomic_fetch_add_explicit(campo, valor, memory_order_relaxed);
+    } else {
+        // Só esta thread escreve na fatia: carga e escrita relaxadas bastam
+        atomic_store_explicit(campo, atomic_load_explicit(campo, memory_order_relaxed) + valor,
+                              memory_order_relaxed);
+    }
+}
+
+void somarMetrica(int id, unsigned long long valor) {
+    if (fatiaLocal == NULL) {
+        fatiaLocal = reservarFatia();
+    }
+    somarValor(fatiaLocal, &fatiaLocal->valores[id], valor);
+}
+
+void incrementarMetrica(int id) {
+    somarMetrica(id, 1);
+}
+
+/*
+ * Registra uma amostra em um histograma logarítmico
+ */
+void registrarAmostra(int id, unsigned long long valor) {
+    int balde = 0;
+    while (balde < BALDES_HISTOGRAMA - 1 && (valor >> balde) != 0) {
+        balde++;
+    }
+    somarMetrica(id, valor);
+    somarValor(fatiaLocal, &fatiaLocal->baldes[id][balde], 1);
+}
+
+int quantidadeMetricas() {
+    return totalMetricas;
+}
+
+/*
+ * Soma todas as fatias
+ */
+void capturarMetricas(SnapshotMetricas* snapshot) {
+    memset(snapshot, 0, sizeof(SnapshotMetricas));
+    for (int f = 0; f <= MAX_FATIAS; f++) {
+        for (int id = 0; id < totalMetricas; id++) {
+            snapshot->valores[id] += atomic_load_explicit(&fatiasMetricas[f].valores[id], memory_order_relaxed);
+            if (tiposMetricas[id] == METRICA_HISTOGRAMA) {
+                for (int b = 0; b < BALDES_HISTOGRAMA; b++) {
+                    snapshot->baldes[id][b] += atomic_load_explicit(&fatiasMetricas[f].baldes[id][b],
+                                                                    memory_order_relaxed);
+                }
+            }
+        }
+    }
+}
+
+void diferencaMetricas(const SnapshotMetricas* depois, const SnapshotMetricas* antes,
+                       SnapshotMetricas* delta) {
+    for (int id = 0; id < MAX_METRICAS; id++) {
+        delta->valores[id] = depois->valores[id] - antes->valores[id];
+        for (int b = 0; b < BALDES_HISTOGRAMA; b++) {
+            delta->baldes[id][b] = depois->baldes[id][b] - antes->baldes[id][b];
+        }
+    }
+}
+
+/*
+ * Marca o instante atual como zero para lerMetrica()
+ * Nenhuma fatia é apagada, então threads em andamento não perdem incrementos
+ */
+void zerarMetricas() {
+    capturarMetricas(&linhaBaseMetricas);
+}
+
+/*
+ * Valor de uma métrica desde o último zerarMetricas()
+ */
+unsigned long long lerMetrica(int id) {
+    unsigned long long total = 0;
+    for (int f = 0; f <= MAX_FATIAS; f++) {
+        total += atomic_load_explicit(&fatiasMetricas[f].valores[id], memory_order_relaxed);
+    }
+    return total - linhaBaseMetricas.valores[id];
+}
+
+unsigned long long amostrasHistograma(const SnapshotMetricas* snapshot, int id) {
+    unsigned long long amostras = 0;
+    for (int b = 0; b < BALDES_HISTOGRAMA; b++) {
+        amostras += snapshot->baldes[id][b];
+    }
+    return amostras;
+}
+
+/*
+ * Exporta um instantâneo em JSON
+ * Histogramas trazem a soma, o número de amostras e os baldes; o balde k
+ * cobre valores em [2^(k-1), 2^k), e o balde 0 conta as amostras iguais a zero
+ */
+void exportarMetricasJSON(FILE* saida, const SnapshotMetricas* snapshot) {
+    fprintf(saida, "{\n  \"metricas\": [\n");
+    for (int id = 0; id < totalMetricas; id++) {
+        if (tiposMetricas[id] == METRICA_CONTADOR) {
+            fprintf(saida, "    {\"nome\": \"%s\", \"tipo\": \"contador\", \"valor\": %llu}",
+                    nomesMetricas[id], snapshot->valores[id]);
+        } else {
+            fprintf(saida, "    {\"nome\": \"%s\", \"tipo\": \"histograma\", \"soma\": %llu, "
+                    "\"amostras\": %llu, \"baldes\": [", nomesMetricas[id], snapshot->valores[id],
+                    amostrasHistograma(snapshot, id));
+            for (int b = 0; b < BALDES_HISTOGRAMA; b++) {
+                fprintf(saida, "%s%llu", b > 0 ? ", " : "", snapshot->baldes[id][b]);
+            }
+            fprintf(saida, "]}");
+        }
+        fprintf(saida, "%s\n", id < totalMetricas - 1 ? "," : "");
+    }
+    fprintf(saida, "  ]\n}\n");
+}
@@ -0,0 +1,106 @@
+/*
+ * Registro de Métricas de Instrumentação
+ *
+ * Contadores e histogramas com nome, usados pelos módulos para contar
+ * comparações e operações dos algoritmos.
+ *
+ * Cada thread escreve apenas na própria fatia (alinhada a uma linha de cache),
+ * com um incremento relaxado sem instrução atômica de leitura-modificação-escrita.
+ * Os valores só são somados na leitura. Assim, algoritmos rodando em paralelo não
+ * disputam a mesma linha de cache nem perdem incrementos.
+ *
+ * Uso:
+ * - registrarMetrica() no início do programa, antes de criar threads
+ * - incrementarMetrica() / somarMetrica() nos laços
+ * - registrarAmostra() para histogramas (ex: comparações por busca)
+ * - zerarMetricas() + lerMetrica() para medir um trecho
+ * - capturarMetricas() + diferencaMetricas() para instantâneos
+ * - exportarMetricasJSON() para saída legível por máquina
+ *
+ * Nos laços internos use as macros CONTAR/SOMAR/AMOSTRAR/CONTAR_LOCAL: compilando
+ * com -DINSTRUMENTACAO=0 elas desaparecem, e o laço fica sem nenhuma escrita extra
+ */
+
+#ifndef METRICAS_H
+#define METRICAS_H
+
+#include <stdio.h>
+
+#define MAX_METRICAS 24        // Métricas registráveis
+#define TAMANHO_NOME_METRICA 48
+#define BALDES_HISTOGRAMA 16   // Balde k conta amostras com k bits significativos
+#define MAX_FATIAS 32          // Fatias exclusivas; threads excedentes dividem uma extra
+
+#ifndef INSTRUMENTACAO
+#define INSTRUMENTACAO 1       // 0 remove a contagem dos laços (compilação de produção)
+#endif
+
+typedef enum {
+    METRICA_CONTADOR,
+    METRICA_HISTOGRAMA
+} TipoMetrica;
+
+// Valores agregados de todas as fatias em um instante
+typedef struct {
+    unsigned long long valores[MAX_METRICAS];
+    unsigned long long baldes[MAX_METRICAS][BALDES_HISTOGRAMA];
+} SnapshotMetricas;
+
+/*
+ * Registra uma métrica e retorna seu identificador (-1 se o registro estiver cheio)
+ */
+int registrarMetrica(const char* nome, TipoMetrica tipo);
+
+// Quantidade de métricas registradas
+int quantidadeMetricas();
+
+void somarMetrica(int id, unsigned long long valor);
+
+void incrementarMetrica(int id);
+
+/*
+ * Registra uma amostra em um histograma logarítmico
+ */
+void registrarAmostra(int id, unsigned long long valor);
+
+/*
+ * Soma todas as fatias
+ */
+void capturarMetricas(SnapshotMetricas* snapshot);
+
+void diferencaMetricas(const SnapshotMetricas* depois, const SnapshotMetricas* antes,
+                       SnapshotMetricas* delta);
+
+/*
+ * Marca o instante atual como zero para lerMetrica()
+ * Nenhuma fatia é apagada, então threads em andamento não perdem incrementos
+ */
+void zerarMetricas();
+
+/*
+ * Valor de uma métrica desde o último zerarMetricas()
+ */
+unsigned long long lerMetrica(int id);
+
+unsigned long long amostrasHistograma(const SnapshotMetricas* snapshot, int id);
+
+/*
+ * Exporta um instantâneo em JSON
+ * Histogramas trazem a soma, o número de amostras e os baldes; o balde k
+ * cobre valores em [2^(k-1), 2^k), e o balde 0 conta as amostras iguais a zero
+ */
+void exportarMetricasJSON(FILE* saida, const SnapshotMetricas* snapshot);
+
+#if INSTRUMENTACAO
+#define CONTAR(id) incrementarMetrica(id)
+#define SOMAR(id, valor) somarMetrica(id, valor)
+#define AMOSTRAR(id, valor) registrarAmostra(id, valor)
+#define CONTAR_LOCAL(contador) ((contador)++)
+#else
+#define CONTAR(id) ((void)0)
+#define SOMAR(id, valor) ((void)(valor))
+#define AMOSTRAR(id, valor) ((void)(valor))
+#define CONTAR_LOCAL(contador) ((void)sizeof(contador))
+#endif
+
+#endif
@@ -3,35 +3,146 @@
  * Este programa implementa um sistema de inventário que simula uma mochila
  * virtual para um jogo de sobrevivência. O jogador pode cadastrar, remover,
  * listar e buscar itens em sua mochila.
+ * Um filtro de Bloom na frente das buscas por nome descarta nomes ausentes
+ * sem percorrer o inventário, e uma árvore radix (radix.h) indexa os nomes
+ * para busca exata, busca por prefixo e listagem em ordem alfabética.
+ * Nomes e tipos são comparados pela chave normalizada (colacao.h), sem
+ * diferenciar maiúsculas nem acentos: "Kit Médico" e "kit medico" são o mesmo item.
+ * A opção 8 lista só os itens de um tipo e/ou faixa de quantidade, com as
+ * condições combinadas como mapas de bits (selecao.h).
+ * Quando o nome buscado não existe, a busca sugere os itens a poucas edições
+ * de distância (aproximada.h), então "Pistla" sugere "Pistola".
+ * Cadastros, remoções e mudanças de quantidade vão para um diário de operações
+ * (write-ahead log) e sobrevivem ao fim do programa; veja abrirDiario().
+ * Além da mochila do menu, o servidor do jogo guarda uma mochila por jogador em
+ * um mapa fragmentado por ID (jogadores.h), com uma trava por fragmento; a
+ * opção 7 mede como ele escala com threads e mostra a disputa das travas.
+ * Item, filtro de Bloom, tabela e buscas vêm do motor compartilhado (inventario.h);
+ * compile com make (a sincronização em grupo roda em uma thread própria).
  */
 
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
 
-// Definição da estrutura Item para representar os itens do inventário
-typedef struct {
-    char nome[30];      // Nome do item (ex: "AK-47", "Kit Médico")
-    char tipo[20];      // Tipo do item (ex: "arma", "munição", "cura")
-    int quantidade;     // Quantidade do item no inventário
-} Item;
+#include "inventario.h"
+#include "radix.h"
+#include "colacao.h"
+#include "jogadores.h"
+#include "aproximada.h"
+#include "selecao.h"
 
 // Constantes do sistema
 #define MAX_ITENS 10
-#define TAMANHO_NOME 30
-#define TAMANHO_TIPO 20
+#define ARQUIVO_DIARIO "inventario.wal"     // Operações desde o último checkpoint
+#define ARQUIVO_SNAPSHOT "inventario.snap"  // Inventário completo no último checkpoint
+#define CHECKPOINT_OPERACOES 1000           // Operações no diário que disparam um checkpoint
+#define INTERVALO_GRUPO_PADRAO 10           // Milissegundos entre sincronizações em grupo
+#define CAPACIDADE_GRUPO 256                // Registros acumulados antes de descarregar
+#define FRAGMENTOS_PADRAO 64                // Fragmentos do mapa de mochilas dos jogadores
+#define MAX_THREADS_MEDICAO 64
+
+typedef enum {
+    OPERACAO_CABECALHO,   // Primeiro registro do snapshot (quantidade = total de itens)
+    OPERACAO_INSERIR,
+    OPERACAO_REMOVER,
+    OPERACAO_QUANTIDADE   // Guarda a quantidade final, então reaplicar é idempotente
+} TipoOperacao;
+
+// Quando o diário chama fdatasync
+typedef enum {
+    SINCRONIA_CADA_OPERACAO,  // Nada confirmado se perde, um fdatasync por operação
+    SINCRONIA_GRUPO,          // Até intervaloMs de operações ficam só na memória do processo:
+                              // perdidas se o processo ou o sistema cair
+    SINCRONIA_NENHUMA         // write a cada operação: sobrevive à queda do processo, não à do
+                              // sistema, que grava no disco quando quiser
+} PoliticaSincronia;
+
+// Registro de tamanho fixo do diário; as entradas do snapshot usam o mesmo formato
+// Um registro cortado ou corrompido no fim do arquivo falha na verificação e é descartado
+typedef struct {
+    unsigned long long sequencia;
+    int operacao;
+    int quantidade;
+    char nome[TAMANHO_NOME];
+    char tipo[TAMANHO_TIPO];
+    unsigned int verificacao;  // FNV-1a dos bytes anteriores
+} RegistroDiario;
+
+typedef struct {
+    int descritor;
+    PoliticaSincronia politica;
+    int intervaloMs;
+    unsigned long long proximaSequencia;
+    int operacoesDesdeCheckpoint;
+    int checkpointSuspenso;         // Medição em andamento: não grava snapshot
+    
+    // Sincronização em grupo: as operações entram em pendentes e a thread
+    // sincronizadora troca os buffers, grava e chama fdatasync fora da trava
+    pthread_mutex_t trava;          // Protege pendentes
+    pthread_mutex_t travaEscrita;   // Protege saida e a ordem das escritas no arquivo
+    pthread_cond_t sinal;
+    RegistroDiario bufferA[CAPACIDADE_GRUPO];
+    RegistroDiario bufferB[CAPACIDADE_GRUPO];
+    RegistroDiario* pendentes;
+    RegistroDiario* saida;
+    int totalPendentes;
+    pthread_t sincronizador;
+    int sincronizadorAtivo;
+    int encerrar;
+    
+    long registros;
+    long sincronizacoes;
+    long checkpoints;
+} Diario;
 
 // Variáveis globais
 Item inventario[MAX_ITENS];  // Vetor para armazenar os itens
 int totalItens = 0;          // Contador de itens no inventário
+FiltroBloom filtroNomes;     // Filtro dos nomes presentes no inventário
+ArvoreRadix indiceNomes;     // Nome -> posição do item em inventario
+Diario diario;               // Diário de operações do inventário
+MapaMochilas mapaJogadores;  // Mochilas dos jogadores do servidor (fora do diário)
 
 // Declaração das funções
 void exibirMenu();
 void inserirItem();
 void removerItem();
 void listarItens();
+void imprimirItensSelecionados(const unsigned long long selecao[]);
+void filtrarItens();
 void buscarItem();
-void limparBuffer();
+void listarPorPrefixo();
+int buscarIndiceItem(char* nome);
+
+// Funções do filtro de Bloom (o filtro em si vem de inventario.h)
+void reconstruirBloom();
+void exibirEstatisticasBloom(const FiltroBloom* filtro);
+
+// Funções de alteração do inventário (sem registro no diário)
+int aplicarInsercao(const char* nome, const char* tipo, int quantidade);
+void aplicarRemocao(int indice);
+
+// Funções do diário de operações
+void abrirDiario();
+void registrarNoDiario(TipoOperacao operacao, const Item* item);
+void descarregarDiario(int sincronizar);
+void definirPoliticaDiario(PoliticaSincronia politica, int intervaloMs);
+int gravarCheckpoint();
+void encerrarDiario();
+void configurarDurabilidade();
+
+// Funções das mochilas dos jogadores (o mapa em si vem de jogadores.h)
+void gerenciarJogadores();
+void povoarJogadores(MapaMochilas* mapa, int jogadores, unsigned int semente);
+void medirEscalabilidade();
+void exibirDisputaFragmentos(MapaMochilas* mapa);
 
 /*
  * Função principal do programa
@@ -43,6 +154,14 @@ int main() {
     printf("=== SISTEMA DE INVENTÁRIO - JOGO DE SOBREVIVÊNCIA ===\n");
     printf("Bem-vindo ao seu sistema de mochila virtual!\n\n");
     
+    inicializarBloom(&filtroNomes);
+    inicializarRadix(&indiceNomes);
+    abrirDiario();
+    if (!inicializarMapaMochilas(&mapaJogadores, FRAGMENTOS_PADRAO, MAX_ITENS)) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return 1;
+    }
+    
     // Loop principal do programa
     do {
         exibirMenu();
@@ -66,6 +185,20 @@ int main() {
                 buscarItem();
                 break;
             case 5:
+                listarPorPrefixo();
+                break;
+            case 6:
+                configurarDurabilidade();
+                break;
+            case 7:
+                gerenciarJogadores();
+                break;
+            case 8:
+                filtrarItens();
+                break;
+            case 9:
+                encerrarDiario();
+                liberarMapaMochilas(&mapaJogadores);
                 printf("Saindo do sistema... Boa sorte na sobrevivência!\n");
                 break;
             default:
@@ -74,7 +207,7 @@ int main() {
         
         printf("\n");
         
-    } while(opcao != 5);
+    } while(opcao != 9);
     
     return 0;
 }
@@ -88,16 +221,55 @@ void exibirMenu() {
     printf("2. Remover item\n");
     printf("3. Listar todos os itens\n");
     printf("4. Buscar item\n");
-    printf("5. Sair\n");
+    printf("5. Listar itens por prefixo (ordem alfabética)\n");
+    printf("6. Durabilidade (diário e checkpoint)\n");
+    printf("7. Mochilas dos jogadores (mapa fragmentado)\n");
+    printf("8. Filtrar itens (tipo e faixa de quantidade)\n");
+    printf("9. Sair\n");
     printf("=====================\n");
 }
 
 /*
- * Limpa o buffer de entrada para evitar problemas com scanf
+ * Acrescenta o item ao inventário e aos índices
+ * Usada pelo cadastro e pela recuperação do diário; retorna a posição do item
+ * ou -1 se o inventário estiver cheio
  */
-void limparBuffer() {
-    int c;
-    while ((c = getchar()) != '\n' && c != EOF);
+int aplicarInsercao(const char* nome, const char* tipo, int quantidade) {
+    if (totalItens >= MAX_ITENS) {
+        return -1;
+    }
+    
+    Item* item = &inventario[totalItens];
+    strncpy(item->nome, nome, TAMANHO_NOME - 1);
+    item->nome[TAMANHO_NOME - 1] = '\0';
+    strncpy(item->tipo, tipo, TAMANHO_TIPO - 1);
+    item->tipo[TAMANHO_TIPO - 1] = '\0';
+    item->quantidade = quantidade;
+    prepararChavesItem(item);
+    
+    totalItens++;
+    adicionarBloom(&filtroNomes, item->chaveNome);
+    inserirRadix(&indiceNomes, item->chaveNome, totalItens - 1);
+    return totalItens - 1;
+}
+
+/*
+ * Remove o item da posição, reorganizando o vetor e os índices
+ */
+void aplicarRemocao(int indice) {
+    // Os itens deslocados mudam de posição no índice
+    removerRadix(&indiceNomes, inventario[indice].chaveNome);
+    for (int i = indice; i < totalItens - 1; i++) {
+        inventario[i] = inventario[i + 1];
+        inserirRadix(&indiceNomes, inventario[i].chaveNome, i);
+    }
+    
+    totalItens--;
+    
+    // Os bits do nome removido continuam no filtro; reconstrói quando acumulam
+    if (registrarRemocaoBloom(&filtroNomes)) {
+        reconstruirBloom();
+    }
 }
 
 
@@ -119,43 +291,46 @@ void inserirItem() {
     
     // Solicita o nome do item
     printf("Digite o nome do item: ");
-    fgets(novoItem.nome, TAMANHO_NOME, stdin);
-    // Remove a quebra de linha do fgets
-    novoItem.nome[strcspn(novoItem.nome, "\n")] = 0;
+    if (!lerTexto(novoItem.nome, TAMANHO_NOME)) {
+        printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+        return;
+    }
     
     // Verifica se o item já existe
-    for (int i = 0; i < totalItens; i++) {
-        if (strcmp(inventario[i].nome, novoItem.nome) == 0) {
-            printf("⚠️  Item '%s' já existe no inventário!\n", novoItem.nome);
-            printf("Quantidade atual: %d\n", inventario[i].quantidade);
-            printf("Deseja aumentar a quantidade? (s/n): ");
-            
-            char resposta;
-            scanf(" %c", &resposta);
+    int i = buscarIndiceItem(novoItem.nome);
+    if (i != -1) {
+        printf("⚠️  Item '%s' já existe no inventário!\n", novoItem.nome);
+        printf("Quantidade atual: %d\n", inventario[i].quantidade);
+        printf("Deseja aumentar a quantidade? (s/n): ");
+        
+        char resposta;
+        scanf(" %c", &resposta);
+        limparBuffer();
+        
+        if (resposta == 's' || resposta == 'S') {
+            int quantidadeAdicional;
+            printf("Digite a quantidade a adicionar: ");
+            scanf("%d", &quantidadeAdicional);
             limparBuffer();
             
-            if (resposta == 's' || resposta == 'S') {
-                int quantidadeAdicional;
-                printf("Digite a quantidade a adicionar: ");
-                scanf("%d", &quantidadeAdicional);
-                limparBuffer();
-                
-                if (quantidadeAdicional > 0) {
-                    inventario[i].quantidade += quantidadeAdicional;
-                    printf("✅ Quantidade atualizada! Total: %d\n", inventario[i].quantidade);
-                    listarItens();
-                } else {
-                    printf("❌ Quantidade inválida!\n");
-                }
+            if (quantidadeAdicional > 0) {
+                inventario[i].quantidade += quantidadeAdicional;
+                registrarNoDiario(OPERACAO_QUANTIDADE, &inventario[i]);
+                printf("✅ Quantidade atualizada! Total: %d\n", inventario[i].quantidade);
+                listarItens();
+            } else {
+                printf("❌ Quantidade inválida!\n");
             }
-            return;
         }
+        return;
     }
     
     // Solicita o tipo do item
     printf("Digite o tipo do item (arma/munição/cura/ferramenta): ");
-    fgets(novoItem.tipo, TAMANHO_TIPO, stdin);
-    novoItem.tipo[strcspn(novoItem.tipo, "\n")] = 0;
+    if (!lerTexto(novoItem.tipo, TAMANHO_TIPO)) {
+        printf("❌ ERRO: Tipo muito longo (máximo %d caracteres)!\n", TAMANHO_TIPO - 1);
+        return;
+    }
     
     // Solicita a quantidade
     printf("Digite a quantidade: ");
@@ -169,8 +344,8 @@ void inserirItem() {
     }
     
     // Adiciona o item ao inventário
-    inventario[totalItens] = novoItem;
-    totalItens++;
+    int posicao = aplicarInsercao(novoItem.nome, novoItem.tipo, novoItem.quantidade);
+    registrarNoDiario(OPERACAO_INSERIR, &inventario[posicao]);
     
     printf("✅ Item '%s' adicionado com sucesso!\n", novoItem.nome);
     
@@ -193,17 +368,13 @@ void removerItem() {
     
     printf("=== REMOVER ITEM ===\n");
     printf("Digite o nome do item a ser removido: ");
-    fgets(nomeItem, TAMANHO_NOME, stdin);
-    nomeItem[strcspn(nomeItem, "\n")] = 0;
+    if (!lerTexto(nomeItem, TAMANHO_NOME)) {
+        printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+        return;
+    }
     
     // Busca o item no inventário
-    int indiceItem = -1;
-    for (int i = 0; i < totalItens; i++) {
-        if (strcmp(inventario[i].nome, nomeItem) == 0) {
-            indiceItem = i;
-            break;
-        }
-    }
+    int indiceItem = buscarIndiceItem(nomeItem);
     
     // Verifica se o item foi encontrado
     if (indiceItem == -1) {
@@ -228,12 +399,9 @@ void removerItem() {
         return;
     }
     
-    // Remove o item reorganizando o vetor
-    for (int i = indiceItem; i < totalItens - 1; i++) {
-        inventario[i] = inventario[i + 1];
-    }
-    
-    totalItens--;
+    Item removido = inventario[indiceItem];
+    aplicarRemocao(indiceItem);
+    registrarNoDiario(OPERACAO_REMOVER, &removido);
     
     printf("✅ Item '%s' removido com sucesso!\n", nomeItem);
     
@@ -257,33 +425,19 @@ void listarItens() {
     
     printf("Total de itens: %d/%d\n\n", totalItens, MAX_ITENS);
     
-    // Cabeçalho da tabela
-    printf("┌─────┬──────────────────────────────┬────────────────────┬────────────┐\n");
-    printf("│ Nº  │ Nome                         │ Tipo               │ Quantidade │\n");
-    printf("├─────┼──────────────────────────────┼────────────────────┼────────────┤\n");
-    
     // Lista todos os itens
-    for (int i = 0; i < totalItens; i++) {
-        printf("│ %-3d │ %-28s │ %-18s │ %-10d │\n", 
-               i + 1, 
-               inventario[i].nome, 
-               inventario[i].tipo, 
-               inventario[i].quantidade);
-    }
-    
-    printf("└─────┴──────────────────────────────┴────────────────────┴────────────┘\n");
+    imprimirItensSelecionados(NULL);
     
     // Estatísticas por tipo
     printf("\n=== ESTATÍSTICAS POR TIPO ===\n");
     int contadores[4] = {0}; // arma, munição, cura, outros
     
     for (int i = 0; i < totalItens; i++) {
-        if (strstr(inventario[i].tipo, "arma") != NULL) {
+        if (strstr(inventario[i].chaveTipo, "arma") != NULL) {
             contadores[0]++;
-        } else if (strstr(inventario[i].tipo, "munição") != NULL || 
-                   strstr(inventario[i].tipo, "municao") != NULL) {
+        } else if (strstr(inventario[i].chaveTipo, "municao") != NULL) {
             contadores[1]++;
-        } else if (strstr(inventario[i].tipo, "cura") != NULL) {
+        } else if (strstr(inventario[i].chaveTipo, "cura") != NULL) {
             contadores[2]++;
         } else {
             contadores[3]++;
@@ -294,8 +448,71 @@ void listarItens() {
     printf("🔸 Munições: %d itens\n", contadores[1]);
     printf("💊 Cura: %d itens\n", contadores[2]);
     printf("🔧 Outros: %d itens\n", contadores[3]);
+    
+    exibirEstatisticasBloom(&filtroNomes);
+}
+
+
+/*
+ * Tabela dos itens cujo bit está ligado em selecao (NULL lista todos)
+ * Nº é a posição do item no inventário, a mesma da listagem completa
+ */
+void imprimirItensSelecionados(const unsigned long long selecao[]) {
+    imprimirCabecalhoTabela("Nº", "Quantidade");
+    for (int i = 0; i < totalItens; i++) {
+        if (selecao == NULL || (selecao[i / 64] >> (i % 64)) & 1) {
+            imprimirLinhaTabela(i + 1, inventario[i].nome, inventario[i].tipo, inventario[i].quantidade);
+        }
+    }
+    imprimirRodapeTabela();
 }
 
+/*
+ * Lista os itens de um tipo com quantidade em uma faixa
+ * ("tipo = munição E quantidade entre 10 e 50"); tipo vazio aceita qualquer um
+ */
+void filtrarItens() {
+    printf("=== FILTRAR ITENS ===\n");
+    
+    if (totalItens == 0) {
+        printf("📦 Inventário vazio! Nenhum item para filtrar.\n");
+        return;
+    }
+    
+    char tipo[TAMANHO_TIPO];
+    char chaveTipo[TAMANHO_TIPO];
+    int minimo, maximo;
+    
+    printf("Tipo (vazio para qualquer): ");
+    if (!lerTexto(tipo, TAMANHO_TIPO)) {
+        printf("❌ ERRO: Tipo muito longo (máximo %d caracteres)!\n", TAMANHO_TIPO - 1);
+        return;
+    }
+    normalizarTexto(tipo, chaveTipo, TAMANHO_TIPO);
+    printf("Quantidade mínima: ");
+    scanf("%d", &minimo);
+    printf("Quantidade máxima: ");
+    scanf("%d", &maximo);
+    limparBuffer();
+    
+    if (minimo > maximo) {
+        printf("❌ Faixa de quantidade inválida!\n");
+        return;
+    }
+    
+    unsigned long long selecao[PALAVRAS_SELECAO(MAX_ITENS)];
+    selecionarFaixaRegistros(inventario, totalItens, sizeof(Item), offsetof(Item, quantidade), minimo, maximo, selecao);
+    if (chaveTipo[0] != '\0') {
+        unsigned long long doTipo[PALAVRAS_SELECAO(MAX_ITENS)];
+        selecionarTextoRegistros(inventario, totalItens, sizeof(Item), offsetof(Item, chaveTipo), chaveTipo, doTipo);
+        intersectarSelecao(selecao, doTipo, totalItens);
+    }
+    
+    printf("\n🔎 Consulta: tipo = %s E quantidade entre %d e %d\n\n",
+           chaveTipo[0] != '\0' ? tipo : "(qualquer)", minimo, maximo);
+    imprimirItensSelecionados(selecao);
+    printf("📋 %d de %d item(ns) selecionado(s)\n", contarSelecao(selecao, totalItens), totalItens);
+}
 
 /*
  * Função para buscar um item específico no inventário
@@ -311,25 +528,17 @@ void buscarItem() {
     
     printf("=== BUSCAR ITEM ===\n");
     printf("Digite o nome do item a ser buscado: ");
-    fgets(nomeBusca, TAMANHO_NOME, stdin);
-    nomeBusca[strcspn(nomeBusca, "\n")] = 0;
-    
-    printf("\nRealizando busca sequencial...\n");
+    if (!lerTexto(nomeBusca, TAMANHO_NOME)) {
+        printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+        return;
+    }
     
-    // Busca sequencial no inventário
-    int encontrado = 0;
-    int posicao = -1;
+    printf("\nConsultando o índice de nomes...\n");
     
-    for (int i = 0; i < totalItens; i++) {
-        // Busca exata
-        if (strcmp(inventario[i].nome, nomeBusca) == 0) {
-            encontrado = 1;
-            posicao = i;
-            break;
-        }
-    }
+    // Busca na árvore radix (o filtro descarta nomes ausentes antes)
+    int posicao = buscarIndiceItem(nomeBusca);
     
-    if (encontrado) {
+    if (posicao != -1) {
         printf("✅ Item encontrado!\n\n");
         printf("=== DETALHES DO ITEM ===\n");
         printf("Posição no inventário: %d\n", posicao + 1);
@@ -345,20 +554,41 @@ void buscarItem() {
     } else {
         printf("❌ Item '%s' não encontrado no inventário.\n", nomeBusca);
         
-        // Busca por similaridade (busca parcial)
+        // Busca por similaridade sobre as chaves normalizadas: primeiro os nomes
+        // a poucas edições de distância (erros de digitação), do mais próximo ao
+        // mais distante, depois os que contêm o texto buscado
         printf("\nBuscando itens similares...\n");
-        int encontrouSimilar = 0;
+        char chaveBusca[TAMANHO_NOME];
+        normalizarTexto(nomeBusca, chaveBusca, TAMANHO_NOME);
+        
+        CandidatoAproximado candidatos[MAX_ITENS];
+        int limite = limitePadraoAproximado((int)strlen(chaveBusca));
+        int totalCandidatos = buscarAproximados(inventario, totalItens, sizeof(Item), offsetof(Item, chaveNome),
+                                                chaveBusca, limite, candidatos, MAX_ITENS);
+        int listado[MAX_ITENS] = {0};
+        int encontrouSimilar = totalCandidatos > 0;
+        
+        if (encontrouSimilar) {
+            printf("Itens similares encontrados:\n");
+        }
+        for (int c = 0; c < totalCandidatos; c++) {
+            const Item* item = &inventario[candidatos[c].indice];
+            listado[candidatos[c].indice] = 1;
+            printf("- %s (Tipo: %s, Quantidade: %d) — %d %s\n", item->nome, item->tipo, item->quantidade,
+                   candidatos[c].distancia, candidatos[c].distancia == 1 ? "edição" : "edições");
+        }
         
         for (int i = 0; i < totalItens; i++) {
-            if (strstr(inventario[i].nome, nomeBusca) != NULL) {
+            if (!listado[i] && strstr(inventario[i].chaveNome, chaveBusca) != NULL) {
                 if (!encontrouSimilar) {
                     printf("Itens similares encontrados:\n");
                     encontrouSimilar = 1;
                 }
-                printf("- %s (Tipo: %s, Quantidade: %d)\n", 
+                printf("- %s (Tipo: %s, Quantidade: %d) — contém \"%s\"\n", 
                        inventario[i].nome, 
                        inventario[i].tipo, 
-                       inventario[i].quantidade);
+                       inventario[i].quantidade,
+                       nomeBusca);
             }
         }
         
@@ -367,3 +597,960 @@ void buscarItem() {
         }
     }
 }
+
+
+/*
+ * Busca exata pelo nome na árvore radix, precedida pelo filtro de Bloom
+ * O nome é normalizado antes, como as chaves guardadas no índice
+ * Retorna o índice do item ou -1 se não existir
+ */
+int buscarIndiceItem(char* nome) {
+    char chave[TAMANHO_NOME];
+    normalizarTexto(nome, chave, TAMANHO_NOME);
+    
+    if (!consultarBloom(&filtroNomes, chave)) {
+        return -1; // Certamente ausente: nem consulta o índice
+    }
+    
+    int indice = buscarRadix(&indiceNomes, chave);
+    
+    registrarResultadoBloom(&filtroNomes, indice != RADIX_SEM_VALOR);
+    return indice;
+}
+
+
+// Imprime um item visitado na árvore radix (com o nome original, não a chave)
+static void exibirItemRadix(const char* chave, int posicao, void* contexto) {
+    (void)chave;
+    (void)contexto;
+    printf("- %s (Tipo: %s, Quantidade: %d)\n", inventario[posicao].nome, inventario[posicao].tipo,
+           inventario[posicao].quantidade);
+}
+
+/*
+ * Lista em ordem alfabética os itens cujo nome começa com um prefixo
+ * A ordem vem da árvore radix, sem ordenar o inventário
+ */
+void listarPorPrefixo() {
+    char prefixo[TAMANHO_NOME];
+    char chavePrefixo[TAMANHO_NOME];
+    
+    printf("=== ITENS POR PREFIXO ===\n");
+    printf("Digite o início do nome (vazio para todos): ");
+    if (!lerTexto(prefixo, TAMANHO_NOME)) {
+        printf("❌ ERRO: Nome muito longo (máximo %d caracteres)!\n", TAMANHO_NOME - 1);
+        return;
+    }
+    normalizarTexto(prefixo, chavePrefixo, TAMANHO_NOME);
+    
+    printf("\n");
+    int encontrados = percorrerRadix(&indiceNomes, chavePrefixo, exibirItemRadix, NULL);
+    if (encontrados == 0) {
+        printf("Nenhum item começa com '%s'.\n", prefixo);
+    } else {
+        printf("\n🔤 %d item(ns) encontrado(s)\n", encontrados);
+    }
+}
+
+
+/*
+ * ========================================
+ * FILTRO DE BLOOM
+ * ========================================
+ */
+
+/*
+ * Refaz o filtro só com os nomes presentes, descartando os bits dos removidos
+ */
+void reconstruirBloom() {
+    // As estatísticas de consultas sobrevivem à reconstrução
+    reiniciarBitsBloom(&filtroNomes);
+    for (int i = 0; i < totalItens; i++) {
+        adicionarBloom(&filtroNomes, inventario[i].chaveNome);
+    }
+}
+
+/*
+ * Exibe ocupação e taxa de falsos positivos observada do filtro
+ */
+void exibirEstatisticasBloom(const FiltroBloom* filtro) {
+    int bitsLigados = bitsLigadosBloom(filtro);
+    
+    printf("\n=== FILTRO DE BLOOM ===\n");
+    printf("🧮 Bits ligados: %d/%d (%.1f%%)\n", bitsLigados, BLOOM_BLOCOS * 512,
+           100.0 * bitsLigados / (BLOOM_BLOCOS * 512));
+    printf("🔎 Consultas: %d | Descartadas sem busca: %d\n", filtro->consultas, filtro->rejeitadas);
+    printf("🎲 Falsos positivos: %d (%.2f%% dos nomes ausentes)\n", filtro->falsosPositivos,
+           taxaFalsosPositivosBloom(filtro));
+}
+
+
+/*
+ * ========================================
+ * DIÁRIO DE OPERAÇÕES (WRITE-AHEAD LOG)
+ * ========================================
+ *
+ * Toda alteração do inventário é anexada a ARQUIVO_DIARIO antes de o menu
+ * seguir adiante. Na inicialização, o inventário é refeito a partir do último
+ * snapshot mais as operações do diário com sequência posterior a ele. A cada
+ * CHECKPOINT_OPERACOES operações (e ao sair), o inventário inteiro vai para um
+ * novo snapshot, gravado em um arquivo temporário e renomeado, e o diário é
+ * esvaziado.
+ */
+
+static unsigned int verificarRegistro(const RegistroDiario* registro) {
+    const unsigned char* bytes = (const unsigned char*)registro;
+    unsigned int hash = 2166136261u;
+    for (size_t i = 0; i < offsetof(RegistroDiario, verificacao); i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void montarRegistro(RegistroDiario* registro, unsigned long long sequencia, TipoOperacao operacao,
+                           const char* nome, const char* tipo, int quantidade) {
+    memset(registro, 0, sizeof(RegistroDiario)); // Zera o preenchimento, que entra na verificação
+    registro->sequencia = sequencia;
+    registro->operacao = operacao;
+    registro->quantidade = quantidade;
+    strncpy(registro->nome, nome, TAMANHO_NOME - 1);
+    strncpy(registro->tipo, tipo, TAMANHO_TIPO - 1);
+    registro->verificacao = verificarRegistro(registro);
+}
+
+// Grava tudo, repetindo em escritas parciais; retorna 0 em erro
+static int escreverTudo(int descritor, const void* dados, size_t tamanho) {
+    const char* p = (const char*)dados;
+    while (tamanho > 0) {
+        ssize_t escritos = write(descritor, p, tamanho);
+        if (escritos < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return 0;
+        }
+        p += escritos;
+        tamanho -= (size_t)escritos;
+    }
+    return 1;
+}
+
+// Lê um registro inteiro; retorna 0 no fim do arquivo ou em registro cortado
+static int lerRegistro(int descritor, RegistroDiario* registro) {
+    char* p = (char*)registro;
+    size_t faltam = sizeof(RegistroDiario);
+    while (faltam > 0) {
+        ssize_t lidos = read(descritor, p, faltam);
+        if (lidos < 0 && errno == EINTR) {
+            continue;
+        }
+        if (lidos <= 0) {
+            return 0;
+        }
+        p += lidos;
+        faltam -= (size_t)lidos;
+    }
+    return 1;
+}
+
+/*
+ * Aplica uma operação recuperada; retorna 0 se ela não couber no estado atual
+ */
+static int reaplicarOperacao(const RegistroDiario* registro) {
+    char chave[TAMANHO_NOME];
+    normalizarTexto(registro->nome, chave, TAMANHO_NOME);
+    int indice = buscarRadix(&indiceNomes, chave);
+    
+    switch (registro->operacao) {
+        case OPERACAO_INSERIR:
+            if (indice != RADIX_SEM_VALOR || registro->quantidade <= 0) {
+                return 0;
+            }
+            return aplicarInsercao(registro->nome, registro->tipo, registro->quantidade) != -1;
+        case OPERACAO_REMOVER:
+            if (indice == RADIX_SEM_VALOR) {
+                return 0;
+            }
+            aplicarRemocao(indice);
+            return 1;
+        case OPERACAO_QUANTIDADE:
+            if (indice == RADIX_SEM_VALOR) {
+                return 0;
+            }
+            inventario[indice].quantidade = registro->quantidade;
+            return 1;
+    }
+    return 0;
+}
+
+/*
+ * Carrega o snapshot; retorna a sequência da última operação contida nele
+ * (0 se não houver snapshot válido)
+ */
+static unsigned long long carregarSnapshot() {
+    int descritor = open(ARQUIVO_SNAPSHOT, O_RDONLY);
+    if (descritor < 0) {
+        return 0;
+    }
+    
+    RegistroDiario cabecalho;
+    RegistroDiario itens[MAX_ITENS];
+    int valido = lerRegistro(descritor, &cabecalho) &&
+                 cabecalho.verificacao == verificarRegistro(&cabecalho) &&
+                 cabecalho.operacao == OPERACAO_CABECALHO &&
+                 cabecalho.quantidade >= 0 && cabecalho.quantidade <= MAX_ITENS;
+    for (int i = 0; valido && i < cabecalho.quantidade; i++) {
+        valido = lerRegistro(descritor, &itens[i]) && itens[i].verificacao == verificarRegistro(&itens[i]);
+    }
+    close(descritor);
+    
+    if (!valido) {
+        printf("⚠️  Snapshot '%s' corrompido: ignorado\n", ARQUIVO_SNAPSHOT);
+        return 0;
+    }
+    for (int i = 0; i < cabecalho.quantidade; i++) {
+        aplicarInsercao(itens[i].nome, itens[i].tipo, itens[i].quantidade);
+    }
+    return cabecalho.sequencia;
+}
+
+/*
+ * Recupera o inventário (snapshot + diário) e abre o diário para novas operações
+ */
+void abrirDiario() {
+    memset(&diario, 0, sizeof(Diario));
+    pthread_mutex_init(&diario.trava, NULL);
+    pthread_mutex_init(&diario.travaEscrita, NULL);
+    pthread_cond_init(&diario.sinal, NULL);
+    diario.pendentes = diario.bufferA;
+    diario.saida = diario.bufferB;
+    diario.descritor = -1;
+    
+    unsigned long long sequenciaSnapshot = carregarSnapshot();
+    int itensSnapshot = totalItens;
+    diario.proximaSequencia = sequenciaSnapshot + 1;
+    
+    diario.descritor = open(ARQUIVO_DIARIO, O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (diario.descritor < 0) {
+        printf("⚠️  Não foi possível abrir '%s': as alterações não serão persistidas\n", ARQUIVO_DIARIO);
+        return;
+    }
+    
+    // Reaplica as operações posteriores ao snapshot; para no primeiro registro inválido
+    RegistroDiario registro;
+    off_t tamanhoValido = 0;
+    int reaplicadas = 0;
+    int ignoradas = 0;
+    while (lerRegistro(diario.descritor, &registro) && registro.verificacao == verificarRegistro(&registro)) {
+        tamanhoValido += sizeof(RegistroDiario);
+        if (registro.sequencia < diario.proximaSequencia) {
+            continue; // Já contida no snapshot (queda entre o snapshot e o esvaziamento do diário)
+        }
+        if (reaplicarOperacao(&registro)) {
+            reaplicadas++;
+        } else {
+            ignoradas++;
+        }
+        diario.proximaSequencia = registro.sequencia + 1;
+        diario.operacoesDesdeCheckpoint++;
+    }
+    
+    // Um registro cortado no fim (queda durante a escrita) é descartado
+    off_t tamanhoArquivo = lseek(diario.descritor, 0, SEEK_END);
+    if (tamanhoArquivo > tamanhoValido) {
+        printf("⚠️  Diário: %ld bytes finais inválidos descartados\n", (long)(tamanhoArquivo - tamanhoValido));
+        if (ftruncate(diario.descritor, tamanhoValido) != 0) {
+            printf("⚠️  Não foi possível truncar '%s'\n", ARQUIVO_DIARIO);
+        }
+    }
+    
+    if (itensSnapshot > 0 || reaplicadas > 0 || ignoradas > 0) {
+        printf("♻️  Inventário recuperado: %d itens do snapshot, %d operações do diário", itensSnapshot, reaplicadas);
+        if (ignoradas > 0) {
+            printf(" (%d sem efeito)", ignoradas);
+        }
+        printf("\n\n");
+    }
+    
+    definirPoliticaDiario(SINCRONIA_GRUPO, INTERVALO_GRUPO_PADRAO);
+}
+
+/*
+ * Grava os registros pendentes e, se pedido, força-os para o disco
+ * A ordem das escritas é a ordem em que os buffers foram trocados: a trava de
+ * escrita é obtida antes de soltar a trava dos pendentes
+ */
+void descarregarDiario(int sincronizar) {
+    pthread_mutex_lock(&diario.trava);
+    pthread_mutex_lock(&diario.travaEscrita);
+    RegistroDiario* registros = diario.pendentes;
+    int total = diario.totalPendentes;
+    diario.pendentes = diario.saida;
+    diario.saida = registros;
+    diario.totalPendentes = 0;
+    pthread_mutex_unlock(&diario.trava);
+    
+    if (total > 0 && diario.descritor >= 0) {
+        if (!escreverTudo(diario.descritor, registros, total * sizeof(RegistroDiario))) {
+            printf("❌ ERRO: Falha ao gravar o diário!\n");
+        } else if (sincronizar) {
+            fdatasync(diario.descritor);
+            diario.sincronizacoes++;
+        }
+    }
+    pthread_mutex_unlock(&diario.travaEscrita);
+}
+
+static void* executarSincronizador(void* arg) {
+    (void)arg;
+    pthread_mutex_lock(&diario.trava);
+    while (!diario.encerrar) {
+        struct timespec prazo;
+        clock_gettime(CLOCK_REALTIME, &prazo);
+        prazo.tv_nsec += (long)diario.intervaloMs * 1000000L;
+        prazo.tv_sec += prazo.tv_nsec / 1000000000L;
+        prazo.tv_nsec %= 1000000000L;
+        pthread_cond_timedwait(&diario.sinal, &diario.trava, &prazo);
+        
+        if (diario.totalPendentes > 0) {
+            pthread_mutex_unlock(&diario.trava);
+            descarregarDiario(1);
+            pthread_mutex_lock(&diario.trava);
+        }
+    }
+    pthread_mutex_unlock(&diario.trava);
+    return NULL;
+}
+
+/*
+ * Troca a política de sincronização; o que estava pendente é gravado antes
+ */
+void definirPoliticaDiario(PoliticaSincronia politica, int intervaloMs) {
+    if (diario.sincronizadorAtivo) {
+        pthread_mutex_lock(&diario.trava);
+        diario.encerrar = 1;
+        pthread_cond_signal(&diario.sinal);
+        pthread_mutex_unlock(&diario.trava);
+        pthread_join(diario.sincronizador, NULL);
+        diario.sincronizadorAtivo = 0;
+        diario.encerrar = 0;
+    }
+    descarregarDiario(diario.politica != SINCRONIA_NENHUMA);
+    
+    diario.politica = politica;
+    diario.intervaloMs = intervaloMs > 0 ? intervaloMs : INTERVALO_GRUPO_PADRAO;
+    if (politica == SINCRONIA_GRUPO && diario.descritor >= 0) {
+        diario.sincronizadorAtivo = pthread_create(&diario.sincronizador, NULL, executarSincronizador, NULL) == 0;
+        if (!diario.sincronizadorAtivo) {
+            printf("⚠️  Sem thread de sincronização: usando sincronização a cada operação\n");
+            diario.politica = SINCRONIA_CADA_OPERACAO;
+        }
+    }
+}
+
+/*
+ * Anexa uma operação ao diário, seguindo a política de sincronização
+ */
+void registrarNoDiario(TipoOperacao operacao, const Item* item) {
+    if (diario.descritor < 0) {
+        return;
+    }
+    
+    pthread_mutex_lock(&diario.trava);
+    montarRegistro(&diario.pendentes[diario.totalPendentes++], diario.proximaSequencia++, operacao,
+                   item->nome, item->tipo, item->quantidade);
+    int cheio = diario.totalPendentes == CAPACIDADE_GRUPO;
+    pthread_mutex_unlock(&diario.trava);
+    diario.registros++;
+    
+    if (diario.politica != SINCRONIA_GRUPO || cheio) {
+        descarregarDiario(diario.politica != SINCRONIA_NENHUMA);
+    }
+    
+    if (++diario.operacoesDesdeCheckpoint >= CHECKPOINT_OPERACOES && !diario.checkpointSuspenso) {
+        gravarCheckpoint();
+    }
+}
+
+/*
+ * Grava o inventário inteiro em um novo snapshot e esvazia o diário
+ * O snapshot vai para um arquivo temporário, sincronizado e renomeado por cima
+ * do anterior: uma queda no meio deixa o snapshot antigo intacto. Retorna 1 se gravou
+ */
+int gravarCheckpoint() {
+    if (diario.descritor < 0) {
+        return 0;
+    }
+    
+    // As operações pendentes já estão no inventário, então o snapshot as cobre
+    pthread_mutex_lock(&diario.trava);
+    pthread_mutex_lock(&diario.travaEscrita);
+    
+    RegistroDiario registros[MAX_ITENS + 1];
+    montarRegistro(&registros[0], diario.proximaSequencia - 1, OPERACAO_CABECALHO, "", "", totalItens);
+    for (int i = 0; i < totalItens; i++) {
+        montarRegistro(&registros[i + 1], 0, OPERACAO_INSERIR, inventario[i].nome, inventario[i].tipo,
+                       inventario[i].quantidade);
+    }
+    
+    int gravou = 0;
+    int descritor = open(ARQUIVO_SNAPSHOT ".tmp", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descritor >= 0) {
+        gravou = escreverTudo(descritor, registros, (totalItens + 1) * sizeof(RegistroDiario)) &&
+                 fsync(descritor) == 0;
+        close(descritor);
+    }
+    if (gravou && rename(ARQUIVO_SNAPSHOT ".tmp", ARQUIVO_SNAPSHOT) == 0) {
+        // Sincroniza o diretório para que a troca de nome também seja durável
+        int diretorio = open(".", O_RDONLY);
+        if (diretorio >= 0) {
+            fsync(diretorio);
+            close(diretorio);
+        }
+        if (ftruncate(diario.descritor, 0) == 0) {
+            diario.totalPendentes = 0;
+            diario.operacoesDesdeCheckpoint = 0;
+        }
+        diario.checkpoints++;
+    } else {
+        gravou = 0;
+        printf("❌ ERRO: Falha ao gravar o snapshot '%s'!\n", ARQUIVO_SNAPSHOT);
+    }
+    
+    pthread_mutex_unlock(&diario.travaEscrita);
+    pthread_mutex_unlock(&diario.trava);
+    return gravou;
+}
+
+/*
+ * Finaliza o diário ao sair: checkpoint, para a thread e fecha o arquivo
+ */
+void encerrarDiario() {
+    if (diario.descritor < 0) {
+        return;
+    }
+    gravarCheckpoint();
+    definirPoliticaDiario(SINCRONIA_NENHUMA, 0);
+    close(diario.descritor);
+    diario.descritor = -1;
+}
+
+// sincronizacoes também é escrita pela thread sincronizadora
+static long lerSincronizacoes() {
+    pthread_mutex_lock(&diario.travaEscrita);
+    long sincronizacoes = diario.sincronizacoes;
+    pthread_mutex_unlock(&diario.travaEscrita);
+    return sincronizacoes;
+}
+
+static double relogioSegundos() {
+    struct timespec agora;
+    clock_gettime(CLOCK_MONOTONIC, &agora);
+    return agora.tv_sec + agora.tv_nsec / 1e9;
+}
+
+static const char* nomePolitica(PoliticaSincronia politica) {
+    switch (politica) {
+        case SINCRONIA_CADA_OPERACAO: return "fdatasync a cada operação";
+        case SINCRONIA_GRUPO: return "sincronização em grupo";
+        default: return "sem fdatasync";
+    }
+}
+
+/*
+ * Mede quantas atualizações de quantidade por segundo cada política sustenta
+ * Regrava a quantidade atual do primeiro item em um diário temporário, sem
+ * checkpoints: o diário real, o snapshot e os contadores ficam como estavam
+ */
+static void medirPoliticas() {
+    if (totalItens == 0) {
+        printf("❌ Cadastre ao menos um item para medir.\n");
+        return;
+    }
+    
+    // No mesmo diretório do diário, para medir o mesmo sistema de arquivos
+    char caminhoTemporario[] = ARQUIVO_DIARIO ".medicao.XXXXXX";
+    int temporario = mkstemp(caminhoTemporario);
+    if (temporario < 0) {
+        printf("❌ ERRO: Falha ao criar o diário temporário da medição!\n");
+        return;
+    }
+    unlink(caminhoTemporario);
+    
+    const int operacoes = 2000;
+    PoliticaSincronia original = diario.politica;
+    int intervaloOriginal = diario.intervaloMs;
+    PoliticaSincronia politicas[] = {SINCRONIA_CADA_OPERACAO, SINCRONIA_GRUPO, SINCRONIA_NENHUMA};
+    
+    // Para a thread sincronizadora (gravando o pendente no diário real) antes de trocar o arquivo
+    definirPoliticaDiario(SINCRONIA_NENHUMA, intervaloOriginal);
+    int descritorReal = diario.descritor;
+    unsigned long long sequenciaReal = diario.proximaSequencia;
+    int operacoesReais = diario.operacoesDesdeCheckpoint;
+    long registrosReais = diario.registros;
+    long sincronizacoesReais = diario.sincronizacoes;
+    diario.descritor = temporario;
+    diario.checkpointSuspenso = 1;
+    
+    printf("⏱️  %d atualizações de quantidade de '%s':\n", operacoes, inventario[0].nome);
+    for (int p = 0; p < 3; p++) {
+        definirPoliticaDiario(politicas[p], intervaloOriginal);
+        long sincronizacoesAntes = lerSincronizacoes();
+        double inicio = relogioSegundos();
+        for (int i = 0; i < operacoes; i++) {
+            registrarNoDiario(OPERACAO_QUANTIDADE, &inventario[0]);
+        }
+        descarregarDiario(politicas[p] != SINCRONIA_NENHUMA);
+        double tempo = relogioSegundos() - inicio;
+        printf("%s %s: %.6f segundos (%.0f operações/s, %ld fdatasync)\n", p == 2 ? "└─" : "├─",
+               nomePolitica(politicas[p]), tempo, tempo > 0 ? operacoes / tempo : 0.0,
+               lerSincronizacoes() - sincronizacoesAntes);
+    }
+    
+    definirPoliticaDiario(SINCRONIA_NENHUMA, intervaloOriginal);
+    close(temporario);
+    diario.descritor = descritorReal;
+    diario.proximaSequencia = sequenciaReal;
+    diario.operacoesDesdeCheckpoint = operacoesReais;
+    diario.registros = registrosReais;
+    diario.sincronizacoes = sincronizacoesReais;
+    diario.checkpointSuspenso = 0;
+    definirPoliticaDiario(original, intervaloOriginal);
+}
+
+/*
+ * Menu de durabilidade: política de sincronização, checkpoint e medição
+ */
+void configurarDurabilidade() {
+    printf("=== DURABILIDADE ===\n");
+    printf("📜 Diário: %s | Snapshot: %s\n", ARQUIVO_DIARIO, ARQUIVO_SNAPSHOT);
+    printf("├─ Política: %s", nomePolitica(diario.politica));
+    if (diario.politica == SINCRONIA_GRUPO) {
+        printf(" (a cada %d ms)", diario.intervaloMs);
+    }
+    printf("\n├─ Operações registradas: %ld | fdatasync: %ld\n", diario.registros, lerSincronizacoes());
+    printf("└─ Operações desde o último checkpoint: %d/%d (checkpoints: %ld)\n\n",
+           diario.operacoesDesdeCheckpoint, CHECKPOINT_OPERACOES, diario.checkpoints);
+    
+    printf("1. Sincronizar a cada operação (nada se perde)\n");
+    printf("2. Sincronização em grupo (queda do processo ou do sistema perde até o intervalo)\n");
+    printf("3. Sem sincronização (queda do processo não perde; do sistema, sim)\n");
+    printf("4. Gravar checkpoint agora\n");
+    printf("5. Medir vazão das políticas\n");
+    printf("6. Voltar\n");
+    printf("Escolha: ");
+    int escolha;
+    scanf("%d", &escolha);
+    limparBuffer();
+    
+    switch (escolha) {
+        case 1:
+            definirPoliticaDiario(SINCRONIA_CADA_OPERACAO, diario.intervaloMs);
+            break;
+        case 2: {
+            int intervalo;
+            printf("Intervalo entre sincronizações (ms): ");
+            scanf("%d", &intervalo);
+            limparBuffer();
+            if (intervalo < 1) {
+                printf("❌ Intervalo inválido!\n");
+                return;
+            }
+            definirPoliticaDiario(SINCRONIA_GRUPO, intervalo);
+            break;
+        }
+        case 3:
+            definirPoliticaDiario(SINCRONIA_NENHUMA, diario.intervaloMs);
+            break;
+        case 4:
+            if (gravarCheckpoint()) {
+                printf("✅ Checkpoint gravado: %d itens em %s\n", totalItens, ARQUIVO_SNAPSHOT);
+            }
+            return;
+        case 5:
+            medirPoliticas();
+            return;
+        default:
+            return;
+    }
+    printf("✅ Política: %s\n", nomePolitica(diario.politica));
+}
+
+
+/*
+ * ========================================
+ * MOCHILAS DOS JOGADORES (MAPA FRAGMENTADO)
+ * ========================================
+ *
+ * O servidor guarda uma mochila por jogador em mapaJogadores, dividido em
+ * FRAGMENTOS_PADRAO fragmentos com uma trava cada (jogadores.h). Essas
+ * mochilas não passam pelo diário: o diário continua cobrindo só a mochila
+ * do menu principal.
+ */
+
+// Itens sorteados pelo povoamento e pela medição
+static const char* NOMES_SORTEADOS[] = {"AK-47", "Kit Médico", "Munição 9mm", "Faca", "Bandagem", "Lanterna",
+                                        "Corda", "Granada", "Cantil", "Mapa", "Pistola", "Rádio"};
+static const char* TIPOS_SORTEADOS[] = {"arma", "cura", "munição", "arma", "cura", "ferramenta",
+                                        "ferramenta", "arma", "ferramenta", "ferramenta", "arma", "ferramenta"};
+#define TOTAL_SORTEADOS ((int)(sizeof(NOMES_SORTEADOS) / sizeof(NOMES_SORTEADOS[0])))
+
+// Trabalho de uma thread da medição
+typedef struct {
+    MapaMochilas* mapa;
+    int jogadores;
+    int operacoes;
+    unsigned int semente;
+} TarefaJogadores;
+
+/*
+ * Dá três itens sorteados a cada jogador de 1 a jogadores
+ */
+void povoarJogadores(MapaMochilas* mapa, int jogadores, unsigned int semente) {
+    for (int jogador = 1; jogador <= jogadores; jogador++) {
+        for (int i = 0; i < 3; i++) {
+            int sorteado = rand_r(&semente) % TOTAL_SORTEADOS;
+            adicionarItemJogador(mapa, (unsigned int)jogador, NOMES_SORTEADOS[sorteado],
+                                 TIPOS_SORTEADOS[sorteado], 1 + rand_r(&semente) % 10);
+        }
+    }
+}
+
+/*
+ * Mix de um servidor de jogo: 70% consultas, 20% coletas e 10% descartes,
+ * cada um em um jogador sorteado
+ */
+static void* executarTarefaJogadores(void* arg) {
+    TarefaJogadores* tarefa = (TarefaJogadores*)arg;
+    int quantidade;
+
+    for (int i = 0; i < tarefa->operacoes; i++) {
+        int operacao = rand_r(&tarefa->semente) % 100;
+        unsigned int jogador = 1 + (unsigned int)(rand_r(&tarefa->semente) % tarefa->jogadores);
+        int sorteado = rand_r(&tarefa->semente) % TOTAL_SORTEADOS;
+
+        if (operacao < 70) {
+            consultarItemJogador(tarefa->mapa, jogador, NOMES_SORTEADOS[sorteado], &quantidade);
+        } else if (operacao < 90) {
+            adicionarItemJogador(tarefa->mapa, jogador, NOMES_SORTEADOS[sorteado], TIPOS_SORTEADOS[sorteado], 1);
+        } else {
+            removerItemJogador(tarefa->mapa, jogador, NOMES_SORTEADOS[sorteado]);
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Roda o mix em cada número de threads (1, 2, 4, ... até o máximo) sobre um
+ * mapa com uma única trava e sobre um mapa com FRAGMENTOS_PADRAO travas
+ * Com uma trava só, toda operação disputa a mesma; fragmentado, a vazão
+ * deve crescer com as threads até o número de núcleos
+ */
+void medirEscalabilidade() {
+    int jogadores, operacoes, maxThreads;
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+
+    printf("Quantidade de jogadores (ex: 200000): ");
+    scanf("%d", &jogadores);
+    printf("Operações por thread (ex: 500000): ");
+    scanf("%d", &operacoes);
+    printf("Máximo de threads (núcleos disponíveis: %ld): ", nucleos);
+    scanf("%d", &maxThreads);
+    limparBuffer();
+
+    if (jogadores < 1 || operacoes < 1 || maxThreads < 1) {
+        printf("❌ Valores inválidos!\n");
+        return;
+    }
+    if (maxThreads > MAX_THREADS_MEDICAO) {
+        maxThreads = MAX_THREADS_MEDICAO;
+    }
+
+    int configuracoes[] = {1, FRAGMENTOS_PADRAO};
+    pthread_t threads[MAX_THREADS_MEDICAO];
+    TarefaJogadores tarefas[MAX_THREADS_MEDICAO];
+
+    for (int c = 0; c < 2; c++) {
+        MapaMochilas mapa;
+        if (!inicializarMapaMochilas(&mapa, configuracoes[c], MAX_ITENS)) {
+            printf("❌ ERRO: Falha na alocação de memória!\n");
+            return;
+        }
+        printf("\n🔄 Povoando %d jogadores em %d fragmento(s)...\n", jogadores, mapa.totalFragmentos);
+        povoarJogadores(&mapa, jogadores, 12345);
+
+        printf("📊 %d fragmento(s):\n", mapa.totalFragmentos);
+        double vazaoUmaThread = 0;
+        for (int t = 1; ; t = t * 2 < maxThreads ? t * 2 : maxThreads) {
+            zerarDisputasMapa(&mapa);
+            int criadas = 0;
+            double inicio = relogioSegundos();
+            for (int i = 0; i < t; i++) {
+                tarefas[i].mapa = &mapa;
+                tarefas[i].jogadores = jogadores;
+                tarefas[i].operacoes = operacoes;
+                tarefas[i].semente = (unsigned int)(i + 1) * 2654435761u;
+                if (pthread_create(&threads[i], NULL, executarTarefaJogadores, &tarefas[i]) != 0) {
+                    break;
+                }
+                criadas++;
+            }
+            for (int i = 0; i < criadas; i++) {
+                pthread_join(threads[i], NULL);
+            }
+            double tempo = relogioSegundos() - inicio;
+
+            unsigned long long aquisicoes = 0, disputas = 0, esperaNs = 0;
+            for (int f = 0; f < mapa.totalFragmentos; f++) {
+                EstatisticasFragmento estatisticas;
+                lerEstatisticasFragmento(&mapa, f, &estatisticas);
+                aquisicoes += estatisticas.aquisicoes;
+                disputas += estatisticas.disputas;
+                esperaNs += estatisticas.esperaNs;
+            }
+
+            double vazao = tempo > 0 ? (double)criadas * operacoes / tempo : 0.0;
+            if (t == 1) {
+                vazaoUmaThread = vazao;
+            }
+            printf("%s %2d thread(s): %10.0f operações/s (%.2fx) | disputas: %.2f%% | espera média: %.2f µs\n",
+                   t == maxThreads ? "└─" : "├─", criadas, vazao,
+                   vazaoUmaThread > 0 ? vazao / vazaoUmaThread : 0.0,
+                   aquisicoes > 0 ? 100.0 * disputas / aquisicoes : 0.0,
+                   disputas > 0 ? esperaNs / 1000.0 / disputas : 0.0);
+            if (criadas < t) {
+                printf("⚠️  Só foi possível criar %d thread(s)\n", criadas);
+                break;
+            }
+            if (t == maxThreads) {
+                break;
+            }
+        }
+        liberarMapaMochilas(&mapa);
+    }
+    if (nucleos < 2) {
+        printf("\n💡 Com um só núcleo as threads se revezam e a vazão não cresce;\n");
+        printf("   as disputas mostram quantas vezes uma thread foi suspensa segurando a trava.\n");
+    }
+}
+
+/*
+ * Mostra a disputa das travas: totais, equilíbrio dos jogadores entre os
+ * fragmentos, memória dos itens e os fragmentos mais disputados
+ */
+void exibirDisputaFragmentos(MapaMochilas* mapa) {
+    EstatisticasFragmento* estatisticas =
+        (EstatisticasFragmento*)malloc((size_t)mapa->totalFragmentos * sizeof(EstatisticasFragmento));
+    if (estatisticas == NULL) {
+        printf("❌ ERRO: Falha na alocação de memória!\n");
+        return;
+    }
+
+    unsigned long long aquisicoes = 0, disputas = 0, esperaNs = 0, redimensionamentos = 0, compactacoes = 0;
+    unsigned long long bytesArena = 0, lixoArena = 0;
+    int menosJogadores = -1, maisJogadores = 0;
+    long jogadores = 0, itens = 0;
+    for (int f = 0; f < mapa->totalFragmentos; f++) {
+        lerEstatisticasFragmento(mapa, f, &estatisticas[f]);
+        aquisicoes += estatisticas[f].aquisicoes;
+        disputas += estatisticas[f].disputas;
+        esperaNs += estatisticas[f].esperaNs;
+        redimensionamentos += estatisticas[f].redimensionamentos;
+        compactacoes += estatisticas[f].compactacoes;
+        bytesArena += estatisticas[f].bytesArena;
+        lixoArena += estatisticas[f].lixoArena;
+        jogadores += estatisticas[f].jogadores;
+        itens += estatisticas[f].itens;
+        if (menosJogadores == -1 || estatisticas[f].jogadores < menosJogadores) {
+            menosJogadores = estatisticas[f].jogadores;
+        }
+        if (estatisticas[f].jogadores > maisJogadores) {
+            maisJogadores = estatisticas[f].jogadores;
+        }
+    }
+
+    printf("=== DISPUTA DAS TRAVAS E MEMÓRIA ===\n");
+    printf("├─ Fragmentos: %d | Jogadores por fragmento: %d a %d (média %.1f)\n", mapa->totalFragmentos,
+           menosJogadores, maisJogadores, (double)jogadores / mapa->totalFragmentos);
+    printf("├─ Aquisições: %llu | Disputas: %llu (%.2f%%)\n", aquisicoes, disputas,
+           aquisicoes > 0 ? 100.0 * disputas / aquisicoes : 0.0);
+    printf("├─ Espera total: %.3f ms | Tabelas redimensionadas: %llu\n", esperaNs / 1e6, redimensionamentos);
+    // Itens compactos mais a arena, contra o mesmo número de Item de tamanho fixo
+    printf("├─ Memória dos itens: %.1f KB (%zu bytes por item + arena de %.1f KB, %.1f KB de lixo, %llu compactações)\n",
+           (itens * sizeof(ItemMochila) + bytesArena) / 1024.0, sizeof(ItemMochila), bytesArena / 1024.0,
+           lixoArena / 1024.0, compactacoes);
+    printf("├─ Com Item de tamanho fixo seriam %.1f KB (%zu bytes por item)\n", itens * sizeof(Item) / 1024.0,
+           sizeof(Item));
+
+    // Os cinco fragmentos mais disputados, por seleção
+    printf("└─ Mais disputados:\n");
+    for (int posicao = 0; posicao < 5 && posicao < mapa->totalFragmentos; posicao++) {
+        int maior = -1;
+        for (int f = 0; f < mapa->totalFragmentos; f++) {
+            if (estatisticas[f].disputas > 0 &&
+                (maior == -1 || estatisticas[f].disputas > estatisticas[maior].disputas)) {
+                maior = f;
+            }
+        }
+        if (maior == -1) {
+            if (posicao == 0) {
+                printf("   (nenhuma disputa registrada)\n");
+            }
+            break;
+        }
+        printf("   #%-4d %6d jogadores | %10llu aquisições | %8llu disputas (%.2f%%)\n", maior,
+               estatisticas[maior].jogadores, estatisticas[maior].aquisicoes, estatisticas[maior].disputas,
+               100.0 * estatisticas[maior].disputas / estatisticas[maior].aquisicoes);
+        estatisticas[maior].disputas = 0; // Já listado
+    }
+
+    free(estatisticas);
+}
+
+/*
+ * Lê uma linha inteira da entrada, sem limite de tamanho e sem a quebra de linha
+ * Retorna NULL no fim da entrada ou sem memória; libere com free
+ */
+static char* lerLinhaLivre() {
+    char* linha = NULL;
+    size_t capacidade = 0;
+    ssize_t lidos = getline(&linha, &capacidade, stdin);
+    if (lidos < 0) {
+        free(linha);
+        return NULL;
+    }
+    linha[strcspn(linha, "\n")] = '\0';
+    return linha;
+}
+
+// Imprime um item visitado em percorrerMochila; o contexto conta as linhas
+static void exibirItemJogador(const char* nome, const char* tipo, int quantidade, void* contexto) {
+    int* ordem = (int*)contexto;
+    imprimirLinhaTabela(++*ordem, nome, tipo, quantidade);
+}
+
+static void exibirMochilaJogador(unsigned int jogador) {
+    int ordem = 0;
+    printf("🎒 Mochila do jogador %u (fragmento %d):\n", jogador, fragmentoDoJogador(&mapaJogadores, jogador));
+    imprimirCabecalhoTabela("Nº", "Quantidade");
+    percorrerMochila(&mapaJogadores, jogador, exibirItemJogador, &ordem);
+    imprimirRodapeTabela();
+    if (ordem == 0) {
+        printf("📦 A mochila do jogador %u está vazia.\n", jogador);
+    }
+}
+
+/*
+ * Cadastra um item na mochila do jogador; nome e tipo não têm limite de tamanho
+ */
+static void cadastrarItemJogador(unsigned int jogador, const char* nome) {
+    printf("Digite o tipo do item (arma/munição/cura/ferramenta): ");
+    char* tipo = lerLinhaLivre();
+    if (tipo == NULL) {
+        return;
+    }
+    int quantidade;
+    printf("Digite a quantidade: ");
+    scanf("%d", &quantidade);
+    limparBuffer();
+
+    if (quantidade <= 0) {
+        printf("❌ ERRO: Quantidade deve ser maior que zero!\n");
+    } else {
+        switch (adicionarItemJogador(&mapaJogadores, jogador, nome, tipo, quantidade)) {
+            case MOCHILA_INSERIDO:
+                printf("✅ Item '%s' adicionado à mochila do jogador %u!\n", nome, jogador);
+                break;
+            case MOCHILA_SOMADO:
+                printf("✅ O jogador %u já tinha '%s'; quantidade somada.\n", jogador, nome);
+                break;
+            case MOCHILA_CHEIA:
+                printf("❌ ERRO: A mochila do jogador %u está cheia (%d itens)!\n", jogador, MAX_ITENS);
+                break;
+            case MOCHILA_SEM_MEMORIA:
+                printf("❌ ERRO: Falha na alocação de memória!\n");
+                break;
+        }
+    }
+    free(tipo);
+}
+
+/*
+ * Menu das mochilas dos jogadores
+ */
+void gerenciarJogadores() {
+    long jogadores = 0, itens = 0;
+    for (int f = 0; f < mapaJogadores.totalFragmentos; f++) {
+        EstatisticasFragmento estatisticas;
+        lerEstatisticasFragmento(&mapaJogadores, f, &estatisticas);
+        jogadores += estatisticas.jogadores;
+        itens += estatisticas.itens;
+    }
+
+    printf("=== MOCHILAS DOS JOGADORES ===\n");
+    printf("🗺️  Fragmentos: %d | Jogadores: %ld | Itens: %ld\n\n", mapaJogadores.totalFragmentos, jogadores, itens);
+    printf("1. Cadastrar item na mochila de um jogador\n");
+    printf("2. Remover item da mochila de um jogador\n");
+    printf("3. Ver a mochila de um jogador\n");
+    printf("4. Povoar com jogadores sorteados\n");
+    printf("5. Medir escalabilidade com threads\n");
+    printf("6. Disputa das travas e memória por fragmento\n");
+    printf("7. Voltar\n");
+    printf("Escolha: ");
+    int escolha;
+    scanf("%d", &escolha);
+    limparBuffer();
+
+    if (escolha >= 1 && escolha <= 3) {
+        unsigned int jogador;
+        printf("ID do jogador: ");
+        scanf("%u", &jogador);
+        limparBuffer();
+
+        if (escolha == 3) {
+            exibirMochilaJogador(jogador);
+            return;
+        }
+
+        printf("Digite o nome do item: ");
+        char* nome = lerLinhaLivre();
+        if (nome == NULL) {
+            return;
+        }
+        if (escolha == 1) {
+            cadastrarItemJogador(jogador, nome);
+        } else if (removerItemJogador(&mapaJogadores, jogador, nome)) {
+            printf("✅ Item '%s' removido da mochila do jogador %u!\n", nome, jogador);
+        } else {
+            printf("❌ O jogador %u não tem o item '%s'.\n", jogador, nome);
+        }
+        free(nome);
+        return;
+    }
+
+    switch (escolha) {
+        case 4: {
+            int quantidade;
+            printf("Quantidade de jogadores: ");
+            scanf("%d", &quantidade);
+            limparBuffer();
+            if (quantidade < 1) {
+                printf("❌ Quantidade inválida!\n");
+                return;
+            }
+            double inicio = relogioSegundos();
+            povoarJogadores(&mapaJogadores, quantidade, (unsigned int)time(NULL));
+            printf("✅ Jogadores 1 a %d povoados em %.3f segundos\n", quantidade, relogioSegundos() - inicio);
+            break;
+        }
+        case 5:
+            medirEscalabilidade();
+            break;
+        case 6:
+            exibirDisputaFragmentos(&mapaJogadores);
+            break;
+        default:
+            break;
+    }
+}
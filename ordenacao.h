@@ -0,0 +1,320 @@
+/*
+ * Motor de Ordenação Genérico
+ *
+ * Macros que geram funções de ordenação especializadas para um tipo e uma
+ * chave. O comparador é uma expressão MENOR(a, b) sobre dois ponteiros,
+ * expandida dentro do laço: não há chamada indireta por comparação, como no
+ * qsort, e o compilador pode otimizar a comparação junto com o laço.
+ *
+ * Exemplo:
+ *   #define MENOR_PRIORIDADE(a, b) ((a)->prioridade < (b)->prioridade)
+ *   DEFINIR_ORDENACOES(Prioridade, Componente, MENOR_PRIORIDADE)
+ *
+ * gera, todas com a assinatura void f(Componente arr[], int n):
+ * - ordenarBubblePrioridade     O(n²), estável
+ * - ordenarInsertionPrioridade  O(n²), estável, O(n) em dados quase ordenados
+ * - ordenarSelectionPrioridade  O(n²), não estável
+ * - ordenarMergePrioridade      O(n log n), estável, usa memória auxiliar
+ * - ordenarQuickPrioridade      O(n log n) médio, não estável, sem memória extra
+ * - ordenarNaturalPrioridade    O(n log n), estável, O(n) em dados quase ordenados:
+ *                               intercala os trechos que já vêm em ordem (powersort)
+ */
+
+#ifndef ORDENACAO_H
+#define ORDENACAO_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LIMITE_INSERCAO 16  // Abaixo disso, Merge e Quick terminam com Insertion Sort
+#define TRECHO_MINIMO 32    // Trechos naturais mais curtos são completados com Insertion Sort
+
+#define DEFINIR_TROCA(Chave, Tipo) \
+static inline void trocar##Chave(Tipo arr[], int a, int b) { \
+    Tipo temp = arr[a]; \
+    arr[a] = arr[b]; \
+    arr[b] = temp; \
+}
+
+// Insertion Sort no intervalo [inicio, fim); insercaoAPartir supõe [inicio, ordenados) já em ordem
+#define DEFINIR_INSERTION_SORT(Chave, Tipo, MENOR) \
+static inline void insercaoAPartir##Chave(Tipo arr[], int inicio, int ordenados, int fim) { \
+    for (int i = ordenados; i < fim; i++) { \
+        Tipo chave = arr[i]; \
+        int j = i - 1; \
+        while (j >= inicio && MENOR(&chave, &arr[j])) { \
+            arr[j + 1] = arr[j]; \
+            j--; \
+        } \
+        arr[j + 1] = chave; \
+    } \
+} \
+static inline void insercaoIntervalo##Chave(Tipo arr[], int inicio, int fim) { \
+    insercaoAPartir##Chave(arr, inicio, inicio + 1, fim); \
+} \
+static inline void ordenarInsertion##Chave(Tipo arr[], int n) { \
+    insercaoIntervalo##Chave(arr, 0, n); \
+}
+
+#define DEFINIR_BUBBLE_SORT(Chave, Tipo, MENOR) \
+static inline void ordenarBubble##Chave(Tipo arr[], int n) { \
+    for (int i = 0; i < n - 1; i++) { \
+        int trocou = 0; \
+        for (int j = 0; j < n - i - 1; j++) { \
+            if (MENOR(&arr[j + 1], &arr[j])) { \
+                trocar##Chave(arr, j, j + 1); \
+                trocou = 1; \
+            } \
+        } \
+        if (!trocou) { \
+            break; \
+        } \
+    } \
+}
+
+#define DEFINIR_SELECTION_SORT(Chave, Tipo, MENOR) \
+static inline void ordenarSelection##Chave(Tipo arr[], int n) { \
+    for (int i = 0; i < n - 1; i++) { \
+        int indiceMenor = i; \
+        for (int j = i + 1; j < n; j++) { \
+            if (MENOR(&arr[j], &arr[indiceMenor])) { \
+                indiceMenor = j; \
+            } \
+        } \
+        if (indiceMenor != i) { \
+            trocar##Chave(arr, i, indiceMenor); \
+        } \
+    } \
+}
+
+// Merge Sort de cima para baixo; pula a intercalação quando as metades já estão em ordem
+#define DEFINIR_MERGE_SORT(Chave, Tipo, MENOR) \
+static inline void mergeIntervalo##Chave(Tipo arr[], Tipo aux[], int inicio, int fim) { \
+    if (fim - inicio <= LIMITE_INSERCAO) { \
+        insercaoIntervalo##Chave(arr, inicio, fim); \
+        return; \
+    } \
+    int meio = inicio + (fim - inicio) / 2; \
+    mergeIntervalo##Chave(arr, aux, inicio, meio); \
+    mergeIntervalo##Chave(arr, aux, meio, fim); \
+    if (!MENOR(&arr[meio], &arr[meio - 1])) { \
+        return; \
+    } \
+    memcpy(aux + inicio, arr + inicio, (size_t)(fim - inicio) * sizeof(Tipo)); \
+    int i = inicio, j = meio, k = inicio; \
+    while (i < meio && j < fim) { \
+        arr[k++] = MENOR(&aux[j], &aux[i]) ? aux[j++] : aux[i++]; \
+    } \
+    while (i < meio) { \
+        arr[k++] = aux[i++]; \
+    } \
+    while (j < fim) { \
+        arr[k++] = aux[j++]; \
+    } \
+} \
+static inline void ordenarMerge##Chave(Tipo arr[], int n) { \
+    Tipo* aux = (Tipo*)malloc((size_t)n * sizeof(Tipo)); \
+    if (aux == NULL) { \
+        printf("❌ ERRO: Falha na alocação de memória!\n"); \
+        return; \
+    } \
+    mergeIntervalo##Chave(arr, aux, 0, n); \
+    free(aux); \
+}
+
+// Quick Sort com mediana de três e partição de Hoare; recursão só no lado menor
+#define DEFINIR_QUICK_SORT(Chave, Tipo, MENOR) \
+static inline void quickIntervalo##Chave(Tipo arr[], int inicio, int fim) { \
+    while (fim - inicio > LIMITE_INSERCAO) { \
+        int meio = inicio + (fim - inicio) / 2; \
+        if (MENOR(&arr[meio], &arr[inicio])) { \
+            trocar##Chave(arr, inicio, meio); \
+        } \
+        if (MENOR(&arr[fim - 1], &arr[meio])) { \
+            trocar##Chave(arr, meio, fim - 1); \
+            if (MENOR(&arr[meio], &arr[inicio])) { \
+                trocar##Chave(arr, inicio, meio); \
+            } \
+        } \
+        Tipo pivo = arr[meio]; \
+        int i = inicio, j = fim - 1; \
+        while (i <= j) { \
+            while (MENOR(&arr[i], &pivo)) { \
+                i++; \
+            } \
+            while (MENOR(&pivo, &arr[j])) { \
+                j--; \
+            } \
+            if (i <= j) { \
+                trocar##Chave(arr, i, j); \
+                i++; \
+                j--; \
+            } \
+        } \
+        if (j + 1 - inicio < fim - i) { \
+            quickIntervalo##Chave(arr, inicio, j + 1); \
+            inicio = i; \
+        } else { \
+            quickIntervalo##Chave(arr, i, fim); \
+            fim = j + 1; \
+        } \
+    } \
+    insercaoIntervalo##Chave(arr, inicio, fim); \
+} \
+static inline void ordenarQuick##Chave(Tipo arr[], int n) { \
+    quickIntervalo##Chave(arr, 0, n); \
+}
+
+/*
+ * Potência da fronteira entre dois trechos vizinhos, como no powersort:
+ * o primeiro bit em que diferem as posições relativas (em [0, 1)) dos
+ * meios dos trechos. Fronteiras de potência menor ficam mais perto do
+ * meio do vetor e são intercaladas por último, o que equilibra a árvore
+ * de intercalações sem precisar de trechos de tamanho parecido
+ */
+static inline int potenciaTrechos(int inicio1, int tamanho1, int tamanho2, int n) {
+    long long a = 2LL * inicio1 + tamanho1;  // Dobro do meio do primeiro trecho
+    long long b = a + tamanho1 + tamanho2;   // Dobro do meio do segundo trecho
+    int potencia = 0;
+    for (;;) {
+        potencia++;
+        if (a >= n) {
+            a -= n;
+            b -= n;
+        } else if (b >= n) {
+            return potencia;
+        }
+        a <<= 1;
+        b <<= 1;
+    }
+}
+
+/*
+ * Natural Merge Sort no estilo do powersort (TimSort com regra de pilha melhor)
+ * - Percorre o vetor achando trechos já em ordem; trechos estritamente
+ *   decrescentes são invertidos (sem iguais, a inversão mantém a estabilidade)
+ * - Trechos com menos de TRECHO_MINIMO itens são completados com Insertion Sort,
+ *   inserindo só os itens depois do trecho achado
+ * - A pilha de trechos é intercalada pela potência das fronteiras
+ * - Cada intercalação pula, por busca binária, o começo da esquerda e o fim
+ *   da direita que já estão no lugar, e copia para aux só o lado menor
+ * Vetor já ordenado custa n - 1 comparações; poucos itens novos no fim de um
+ * vetor ordenado custam perto de O(n)
+ */
+#define DEFINIR_NATURAL_SORT(Chave, Tipo, MENOR) \
+static inline int estenderTrecho##Chave(Tipo arr[], int inicio, int n) { \
+    int fim = inicio + 1; \
+    if (fim < n && MENOR(&arr[fim], &arr[inicio])) { \
+        while (fim + 1 < n && MENOR(&arr[fim + 1], &arr[fim])) { \
+            fim++; \
+        } \
+        fim++; \
+        for (int i = inicio, j = fim - 1; i < j; i++, j--) { \
+            trocar##Chave(arr, i, j); \
+        } \
+    } else if (fim < n) { \
+        while (fim + 1 < n && !MENOR(&arr[fim + 1], &arr[fim])) { \
+            fim++; \
+        } \
+        fim++; \
+    } \
+    if (fim - inicio < TRECHO_MINIMO) { \
+        int completo = inicio + TRECHO_MINIMO < n ? inicio + TRECHO_MINIMO : n; \
+        insercaoAPartir##Chave(arr, inicio, fim, completo); \
+        fim = completo; \
+    } \
+    return fim; \
+} \
+static inline void intercalarTrechos##Chave(Tipo arr[], Tipo aux[], int inicio, int meio, int fim) { \
+    int esquerda = inicio, direita = meio; \
+    while (esquerda < direita) { \
+        int m = esquerda + (direita - esquerda) / 2; \
+        if (MENOR(&arr[meio], &arr[m])) { \
+            direita = m; \
+        } else { \
+            esquerda = m + 1; \
+        } \
+    } \
+    inicio = esquerda; \
+    if (inicio >= meio) { \
+        return; \
+    } \
+    esquerda = meio; \
+    direita = fim; \
+    while (esquerda < direita) { \
+        int m = esquerda + (direita - esquerda) / 2; \
+        if (MENOR(&arr[m], &arr[meio - 1])) { \
+            esquerda = m + 1; \
+        } else { \
+            direita = m; \
+        } \
+    } \
+    fim = esquerda; \
+    if (meio - inicio <= fim - meio) { \
+        int tamanho = meio - inicio; \
+        memcpy(aux, arr + inicio, (size_t)tamanho * sizeof(Tipo)); \
+        int i = 0, j = meio, k = inicio; \
+        while (i < tamanho && j < fim) { \
+            arr[k++] = MENOR(&arr[j], &aux[i]) ? arr[j++] : aux[i++]; \
+        } \
+        while (i < tamanho) { \
+            arr[k++] = aux[i++]; \
+        } \
+    } else { \
+        memcpy(aux, arr + meio, (size_t)(fim - meio) * sizeof(Tipo)); \
+        int i = meio - 1, j = fim - meio - 1, k = fim - 1; \
+        while (i >= inicio && j >= 0) { \
+            arr[k--] = MENOR(&aux[j], &arr[i]) ? arr[i--] : aux[j--]; \
+        } \
+        while (j >= 0) { \
+            arr[k--] = aux[j--]; \
+        } \
+    } \
+} \
+static inline void ordenarNatural##Chave(Tipo arr[], int n) { \
+    if (n < 2) { \
+        return; \
+    } \
+    Tipo* aux = (Tipo*)malloc((size_t)(n / 2 + 1) * sizeof(Tipo)); \
+    if (aux == NULL) { \
+        printf("❌ ERRO: Falha na alocação de memória!\n"); \
+        return; \
+    } \
+    int pilhaInicio[64], pilhaPotencia[64]; \
+    int topo = 0; \
+    int inicio = 0; \
+    int fim = estenderTrecho##Chave(arr, 0, n); \
+    while (fim < n) { \
+        int fimProximo = estenderTrecho##Chave(arr, fim, n); \
+        int potencia = potenciaTrechos(inicio, fim - inicio, fimProximo - fim, n); \
+        while (topo > 0 && pilhaPotencia[topo - 1] > potencia) { \
+            topo--; \
+            intercalarTrechos##Chave(arr, aux, pilhaInicio[topo], inicio, fim); \
+            inicio = pilhaInicio[topo]; \
+        } \
+        pilhaInicio[topo] = inicio; \
+        pilhaPotencia[topo] = potencia; \
+        topo++; \
+        inicio = fim; \
+        fim = fimProximo; \
+    } \
+    while (topo > 0) { \
+        topo--; \
+        intercalarTrechos##Chave(arr, aux, pilhaInicio[topo], inicio, n); \
+        inicio = pilhaInicio[topo]; \
+    } \
+    free(aux); \
+}
+
+// Gera todos os algoritmos para uma chave
+#define DEFINIR_ORDENACOES(Chave, Tipo, MENOR) \
+    DEFINIR_TROCA(Chave, Tipo) \
+    DEFINIR_INSERTION_SORT(Chave, Tipo, MENOR) \
+    DEFINIR_BUBBLE_SORT(Chave, Tipo, MENOR) \
+    DEFINIR_SELECTION_SORT(Chave, Tipo, MENOR) \
+    DEFINIR_MERGE_SORT(Chave, Tipo, MENOR) \
+    DEFINIR_QUICK_SORT(Chave, Tipo, MENOR) \
+    DEFINIR_NATURAL_SORT(Chave, Tipo, MENOR)
+
+#endif
@@ -0,0 +1,285 @@
+/*
+ * Árvore Radix de Nomes - implementação (veja radix.h)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "radix.h"
+
+static NoRadix* criarNoRadix(const char* rotulo, int tamanho, int valor) {
+    NoRadix* no = (NoRadix*)calloc(1, sizeof(NoRadix));
+    if (no == NULL) {
+        return NULL;
+    }
+    no->rotulo = (char*)malloc(tamanho > 0 ? tamanho : 1);
+    if (no->rotulo == NULL) {
+        free(no);
+        return NULL;
+    }
+    memcpy(no->rotulo, rotulo, tamanho);
+    no->tamanhoRotulo = tamanho;
+    no->valor = valor;
+    return no;
+}
+
+static void liberarNoRadix(NoRadix* no) {
+    for (int i = 0; i < no->totalFilhos; i++) {
+        liberarNoRadix(no->filhos[i]);
+    }
+    free(no->filhos);
+    free(no->rotulo);
+    free(no);
+}
+
+void inicializarRadix(ArvoreRadix* arvore) {
+    arvore->raiz = criarNoRadix("", 0, RADIX_SEM_VALOR);
+    arvore->chaves = 0;
+    arvore->nos = 1;
+}
+
+void liberarRadix(ArvoreRadix* arvore) {
+    liberarNoRadix(arvore->raiz);
+    arvore->raiz = NULL;
+    arvore->chaves = 0;
+    arvore->nos = 0;
+}
+
+/*
+ * Posição do filho que começa com o byte c, ou -(posição de inserção) - 1
+ * Busca binária: os filhos estão ordenados
+ */
+static int indiceFilhoRadix(const NoRadix* no, unsigned char c) {
+    int esquerda = 0;
+    int direita = no->totalFilhos - 1;
+    while (esquerda <= direita) {
+        int meio = (esquerda + direita) / 2;
+        unsigned char primeiro = (unsigned char)no->filhos[meio]->rotulo[0];
+        if (primeiro == c) {
+            return meio;
+        } else if (primeiro < c) {
+            esquerda = meio + 1;
+        } else {
+            direita = meio - 1;
+        }
+    }
+    return -esquerda - 1;
+}
+
+static int adicionarFilhoRadix(NoRadix* no, int posicao, NoRadix* filho) {
+    if (no->totalFilhos == no->capacidadeFilhos) {
+        int capacidade = no->capacidadeFilhos ? no->capacidadeFilhos * 2 : 2;
+        NoRadix** filhos = (NoRadix**)realloc(no->filhos, capacidade * sizeof(NoRadix*));
+        if (filhos == NULL) {
+            return 0;
+        }
+        no->filhos = filhos;
+        no->capacidadeFilhos = capacidade;
+    }
+    memmove(&no->filhos[posicao + 1], &no->filhos[posicao],
+            (no->totalFilhos - posicao) * sizeof(NoRadix*));
+    no->filhos[posicao] = filho;
+    no->totalFilhos++;
+    return 1;
+}
+
+static int prefixoComumRadix(const char* a, int tamanhoA, const char* b) {
+    int i = 0;
+    while (i < tamanhoA && b[i] != '\0' && a[i] == b[i]) {
+        i++;
+    }
+    return i;
+}
+
+/*
+ * Insere a chave com o valor; se a chave já existir, só troca o valor
+ * Retorna 1 se a chave é nova, 0 se foi atualizada e -1 em erro
+ */
+int inserirRadix(ArvoreRadix* arvore, const char* chave, int valor) {
+    if (strlen(chave) >= TAMANHO_MAX_CHAVE_RADIX) {
+        return -1;
+    }
+
+    NoRadix* no = arvore->raiz;
+    while (*chave != '\0') {
+        int i = indiceFilhoRadix(no, (unsigned char)*chave);
+        if (i < 0) {
+            // Nenhum filho começa com este byte: o resto da chave vira uma folha
+            NoRadix* folha = criarNoRadix(chave, (int)strlen(chave), valor);
+            if (folha == NULL || !adicionarFilhoRadix(no, -i - 1, folha)) {
+                free(folha != NULL ? folha->rotulo : NULL);
+                free(folha);
+                return -1;
+            }
+            arvore->chaves++;
+            arvore->nos++;
+            return 1;
+        }
+
+        NoRadix* filho = no->filhos[i];
+        int comum = prefixoComumRadix(filho->rotulo, filho->tamanhoRotulo, chave);
+        if (comum < filho->tamanhoRotulo) {
+            // A chave diverge no meio do rótulo: divide o filho em dois
+            NoRadix* meio = criarNoRadix(filho->rotulo, comum, RADIX_SEM_VALOR);
+            if (meio == NULL || !adicionarFilhoRadix(meio, 0, filho)) {
+                free(meio != NULL ? meio->rotulo : NULL);
+                free(meio);
+                return -1;
+            }
+            memmove(filho->rotulo, filho->rotulo + comum, filho->tamanhoRotulo - comum);
+            filho->tamanhoRotulo -= comum;
+            no->filhos[i] = meio;
+            arvore->nos++;
+            filho = meio;
+        }
+        no = filho;
+        chave += comum;
+    }
+
+    int nova = no->valor == RADIX_SEM_VALOR;
+    no->valor = valor;
+    if (nova) {
+        arvore->chaves++;
+    }
+    return nova;
+}
+
+/*
+ * Retorna o valor da chave ou RADIX_SEM_VALOR se ela não existir
+ */
+int buscarRadix(const ArvoreRadix* arvore, const char* chave) {
+    const NoRadix* no = arvore->raiz;
+    while (*chave != '\0') {
+        int i = indiceFilhoRadix(no, (unsigned char)*chave);
+        if (i < 0) {
+            return RADIX_SEM_VALOR;
+        }
+        no = no->filhos[i];
+        if (prefixoComumRadix(no->rotulo, no->tamanhoRotulo, chave) < no->tamanhoRotulo) {
+            return RADIX_SEM_VALOR;
+        }
+        chave += no->tamanhoRotulo;
+    }
+    return no->valor;
+}
+
+/*
+ * Remove a chave de dentro da subárvore e devolve o nó que deve ocupar o
+ * lugar de no no pai: NULL se ele ficou vazio, ou o filho único se os dois
+ * foram fundidos
+ */
+static NoRadix* removerNoRadix(ArvoreRadix* arvore, NoRadix* no, const char* resto,
+                               int ehRaiz, int* removida) {
+    if (*resto == '\0') {
+        if (no->valor == RADIX_SEM_VALOR) {
+            return no;
+        }
+        no->valor = RADIX_SEM_VALOR;
+        *removida = 1;
+    } else {
+        int i = indiceFilhoRadix(no, (unsigned char)*resto);
+        if (i < 0) {
+            return no;
+        }
+        NoRadix* filho = no->filhos[i];
+        if (prefixoComumRadix(filho->rotulo, filho->tamanhoRotulo, resto) < filho->tamanhoRotulo) {
+            return no;
+        }
+        NoRadix* substituto = removerNoRadix(arvore, filho, resto + filho->tamanhoRotulo, 0, removida);
+        if (substituto != NULL) {
+            no->filhos[i] = substituto;
+        } else {
+            memmove(&no->filhos[i], &no->filhos[i + 1], (no->totalFilhos - i - 1) * sizeof(NoRadix*));
+            no->totalFilhos--;
+        }
+    }
+
+    if (ehRaiz || no->valor != RADIX_SEM_VALOR || no->totalFilhos > 1) {
+        return no;
+    }
+    if (no->totalFilhos == 0) {
+        liberarNoRadix(no);
+        arvore->nos--;
+        return NULL;
+    }
+
+    // Sem valor e com um só filho: o filho absorve o rótulo deste nó
+    NoRadix* filho = no->filhos[0];
+    char* rotulo = (char*)malloc(no->tamanhoRotulo + filho->tamanhoRotulo);
+    if (rotulo == NULL) {
+        return no; // Fica sem fundir: a árvore continua correta, só menos compacta
+    }
+    memcpy(rotulo, no->rotulo, no->tamanhoRotulo);
+    memcpy(rotulo + no->tamanhoRotulo, filho->rotulo, filho->tamanhoRotulo);
+    free(filho->rotulo);
+    filho->rotulo = rotulo;
+    filho->tamanhoRotulo += no->tamanhoRotulo;
+    no->totalFilhos = 0;
+    liberarNoRadix(no);
+    arvore->nos--;
+    return filho;
+}
+
+/*
+ * Remove a chave; retorna 1 se ela existia
+ */
+int removerRadix(ArvoreRadix* arvore, const char* chave) {
+    int removida = 0;
+    removerNoRadix(arvore, arvore->raiz, chave, 1, &removida);
+    if (removida) {
+        arvore->chaves--;
+    }
+    return removida;
+}
+
+static int percorrerNoRadix(const NoRadix* no, char* chave, int tamanho,
+                            void (*visitar)(const char*, int, void*), void* contexto) {
+    memcpy(chave + tamanho, no->rotulo, no->tamanhoRotulo);
+    tamanho += no->tamanhoRotulo;
+    chave[tamanho] = '\0';
+
+    // A própria chave vem antes das mais longas que a estendem
+    int visitadas = 0;
+    if (no->valor != RADIX_SEM_VALOR) {
+        visitar(chave, no->valor, contexto);
+        visitadas++;
+    }
+    for (int i = 0; i < no->totalFilhos; i++) {
+        visitadas += percorrerNoRadix(no->filhos[i], chave, tamanho, visitar, contexto);
+    }
+    return visitadas;
+}
+
+/*
+ * Visita em ordem alfabética todas as chaves que começam com o prefixo
+ * (prefixo vazio visita todas); retorna quantas foram visitadas
+ */
+int percorrerRadix(const ArvoreRadix* arvore, const char* prefixo,
+                   void (*visitar)(const char*, int, void*), void* contexto) {
+    char chave[TAMANHO_MAX_CHAVE_RADIX];
+    int tamanho = 0;
+    const NoRadix* no = arvore->raiz;
+
+    // chave guarda o caminho até no, inclusive o rótulo dele
+    while (*prefixo != '\0') {
+        int i = indiceFilhoRadix(no, (unsigned char)*prefixo);
+        if (i < 0) {
+            return 0;
+        }
+        const NoRadix* filho = no->filhos[i];
+        int comum = prefixoComumRadix(filho->rotulo, filho->tamanhoRotulo, prefixo);
+        if (prefixo[comum] == '\0') {
+            // O prefixo termina dentro (ou no fim) deste rótulo: toda a subárvore casa
+            return percorrerNoRadix(filho, chave, tamanho, visitar, contexto);
+        }
+        if (comum < filho->tamanhoRotulo) {
+            return 0; // Diverge no meio do rótulo
+        }
+        memcpy(chave + tamanho, filho->rotulo, filho->tamanhoRotulo);
+        tamanho += filho->tamanhoRotulo;
+        prefixo += comum;
+        no = filho;
+    }
+    return percorrerNoRadix(no, chave, tamanho, visitar, contexto);
+}
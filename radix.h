@@ -0,0 +1,64 @@
+/*
+ * Árvore Radix de Nomes
+ *
+ * Trie compacta (com compressão de caminho): cada nó guarda um trecho da chave
+ * em vez de um único caractere, e nós com um só filho e sem valor são fundidos.
+ * Os filhos ficam ordenados pelo primeiro byte do rótulo, então o percurso em
+ * profundidade visita as chaves na mesma ordem de strcmp, sem ordenar nada.
+ *
+ * Cada chave guarda um valor inteiro (ex: a posição do item no vetor).
+ *
+ * Operações (k = tamanho da chave):
+ * - inserirRadix / buscarRadix / removerRadix: O(k)
+ * - percorrerRadix: todas as chaves com um prefixo, em ordem alfabética
+ */
+
+#ifndef RADIX_H
+#define RADIX_H
+
+#define RADIX_SEM_VALOR (-1)
+#define TAMANHO_MAX_CHAVE_RADIX 256
+
+typedef struct NoRadix {
+    char* rotulo;              // Trecho da chave (sem terminador)
+    int tamanhoRotulo;
+    int valor;                 // RADIX_SEM_VALOR se nenhuma chave termina aqui
+    int totalFilhos;
+    int capacidadeFilhos;
+    struct NoRadix** filhos;   // Ordenados pelo primeiro byte do rótulo
+} NoRadix;
+
+typedef struct {
+    NoRadix* raiz;   // Rótulo vazio
+    int chaves;
+    int nos;
+} ArvoreRadix;
+
+void inicializarRadix(ArvoreRadix* arvore);
+
+void liberarRadix(ArvoreRadix* arvore);
+
+/*
+ * Insere a chave com o valor; se a chave já existir, só troca o valor
+ * Retorna 1 se a chave é nova, 0 se foi atualizada e -1 em erro
+ */
+int inserirRadix(ArvoreRadix* arvore, const char* chave, int valor);
+
+/*
+ * Retorna o valor da chave ou RADIX_SEM_VALOR se ela não existir
+ */
+int buscarRadix(const ArvoreRadix* arvore, const char* chave);
+
+/*
+ * Remove a chave; retorna 1 se ela existia
+ */
+int removerRadix(ArvoreRadix* arvore, const char* chave);
+
+/*
+ * Visita em ordem alfabética todas as chaves que começam com o prefixo
+ * (prefixo vazio visita todas); retorna quantas foram visitadas
+ */
+int percorrerRadix(const ArvoreRadix* arvore, const char* prefixo,
+                   void (*visitar)(const char*, int, void*), void* contexto);
+
+#endif
@@ -0,0 +1,115 @@
+/*
+ * Consultas por Seleção - implementação (veja selecao.h)
+ */
+
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "selecao.h"
+
+// Palavra do mapa para até 64 bytes da coluna, um byte por vez
+static unsigned long long palavraFaixaEscalar(const unsigned char* bloco, int tamanho,
+                                              unsigned char minimo, unsigned char maximo) {
+    unsigned long long palavra = 0;
+    for (int b = 0; b < tamanho; b++) {
+        palavra |= (unsigned long long)(bloco[b] >= minimo && bloco[b] <= maximo) << b;
+    }
+    return palavra;
+}
+
+#ifdef __SSE2__
+// Palavra do mapa para 64 bytes, 16 por comparação: x está na faixa se
+// max(x, minimo) == x e min(x, maximo) == x (comparações sem sinal)
+static unsigned long long palavraFaixaSSE2(const unsigned char* bloco, __m128i minimo, __m128i maximo) {
+    unsigned long long palavra = 0;
+    for (int p = 0; p < 4; p++) {
+        __m128i valores = _mm_loadu_si128((const __m128i*)(bloco + 16 * p));
+        __m128i acima = _mm_cmpeq_epi8(_mm_max_epu8(valores, minimo), valores);
+        __m128i abaixo = _mm_cmpeq_epi8(_mm_min_epu8(valores, maximo), valores);
+        unsigned int bits = (unsigned int)_mm_movemask_epi8(_mm_and_si128(acima, abaixo));
+        palavra |= (unsigned long long)bits << (16 * p);
+    }
+    return palavra;
+}
+#endif
+
+void selecionarFaixaByte(const unsigned char coluna[], int n, unsigned char minimo, unsigned char maximo,
+                         unsigned long long selecao[]) {
+    int completas = n / 64;
+#ifdef __SSE2__
+    __m128i vetorMinimo = _mm_set1_epi8((char)minimo);
+    __m128i vetorMaximo = _mm_set1_epi8((char)maximo);
+    for (int w = 0; w < completas; w++) {
+        selecao[w] = palavraFaixaSSE2(coluna + (size_t)w * 64, vetorMinimo, vetorMaximo);
+    }
+#else
+    for (int w = 0; w < completas; w++) {
+        selecao[w] = palavraFaixaEscalar(coluna + (size_t)w * 64, 64, minimo, maximo);
+    }
+#endif
+    if (n % 64 != 0) {
+        selecao[completas] = palavraFaixaEscalar(coluna + (size_t)completas * 64, n % 64, minimo, maximo);
+    }
+}
+
+void selecionarIgualByte(const unsigned char coluna[], int n, unsigned char valor, unsigned long long selecao[]) {
+    selecionarFaixaByte(coluna, n, valor, valor, selecao);
+}
+
+void selecionarFaixaRegistros(const void* registros, int n, size_t tamanhoRegistro, size_t deslocamentoCampo,
+                              int minimo, int maximo, unsigned long long selecao[]) {
+    const char* campo = (const char*)registros + deslocamentoCampo;
+    memset(selecao, 0, (size_t)PALAVRAS_SELECAO(n) * sizeof(unsigned long long));
+    for (int i = 0; i < n; i++) {
+        int valor;
+        memcpy(&valor, campo + (size_t)i * tamanhoRegistro, sizeof(int));
+        selecao[i / 64] |= (unsigned long long)(valor >= minimo && valor <= maximo) << (i % 64);
+    }
+}
+
+void selecionarTextoRegistros(const void* registros, int n, size_t tamanhoRegistro, size_t deslocamentoCampo,
+                              const char* texto, unsigned long long selecao[]) {
+    const char* campo = (const char*)registros + deslocamentoCampo;
+    memset(selecao, 0, (size_t)PALAVRAS_SELECAO(n) * sizeof(unsigned long long));
+    for (int i = 0; i < n; i++) {
+        selecao[i / 64] |= (unsigned long long)(strcmp(campo + (size_t)i * tamanhoRegistro, texto) == 0) << (i % 64);
+    }
+}
+
+void intersectarSelecao(unsigned long long destino[], const unsigned long long origem[], int n) {
+    for (int w = 0; w < PALAVRAS_SELECAO(n); w++) {
+        destino[w] &= origem[w];
+    }
+}
+
+void unirSelecao(unsigned long long destino[], const unsigned long long origem[], int n) {
+    for (int w = 0; w < PALAVRAS_SELECAO(n); w++) {
+        destino[w] |= origem[w];
+    }
+}
+
+int contarSelecao(const unsigned long long selecao[], int n) {
+    int total = 0;
+    for (int w = 0; w < PALAVRAS_SELECAO(n); w++) {
+        total += __builtin_popcountll(selecao[w]);
+    }
+    return total;
+}
+
+int proximoSelecionado(const unsigned long long selecao[], int n, int inicio) {
+    if (inicio >= n) {
+        return -1;
+    }
+    int w = inicio / 64;
+    unsigned long long palavra = selecao[w] & (~0ULL << (inicio % 64));
+    while (palavra == 0) {
+        if (++w >= PALAVRAS_SELECAO(n)) {
+            return -1;
+        }
+        palavra = selecao[w];
+    }
+    return w * 64 + __builtin_ctzll(palavra);
+}
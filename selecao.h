@@ -0,0 +1,67 @@
+/*
+ * Consultas por Seleção
+ *
+ * Filtros como "tipo = X E quantidade entre a e b" ou "prioridade >= p"
+ * viram mapas de seleção: um bit por registro, 64 registros por palavra.
+ * Cada condição produz o seu mapa, as condições são combinadas palavra a
+ * palavra (E/OU) e a listagem percorre só os bits ligados.
+ *
+ * Sobre colunas de bytes (ids de tipo, prioridades) a varredura compara 16
+ * bytes por instrução com SSE2, presente em todo x86-64, e monta cada
+ * palavra do mapa com movemask, sem nenhum desvio por registro. Em outras
+ * arquiteturas o mesmo laço roda byte a byte.
+ *
+ * Para vetores de registros (Item, Componente) há as varreduras por
+ * tamanho e deslocamento do campo (use offsetof), como as buscas de
+ * inventario.h; elas leem o registro inteiro e servem para poucos itens.
+ *
+ * Os mapas têm PALAVRAS_SELECAO(n) palavras e os bits além de n ficam em zero.
+ */
+
+#ifndef SELECAO_H
+#define SELECAO_H
+
+#include <stddef.h>
+
+#define PALAVRAS_SELECAO(n) (((n) + 63) / 64)
+
+/*
+ * Liga o bit de cada posição da coluna igual a valor
+ */
+void selecionarIgualByte(const unsigned char coluna[], int n, unsigned char valor, unsigned long long selecao[]);
+
+/*
+ * Liga o bit de cada posição com minimo <= coluna[i] <= maximo
+ * ("prioridade >= p" é a faixa de p a 255)
+ */
+void selecionarFaixaByte(const unsigned char coluna[], int n, unsigned char minimo, unsigned char maximo,
+                         unsigned long long selecao[]);
+
+/*
+ * Liga o bit dos registros cujo campo int em deslocamentoCampo está entre minimo e maximo
+ */
+void selecionarFaixaRegistros(const void* registros, int n, size_t tamanhoRegistro, size_t deslocamentoCampo,
+                              int minimo, int maximo, unsigned long long selecao[]);
+
+/*
+ * Liga o bit dos registros cujo texto em deslocamentoCampo é igual a texto
+ * (compare chaves normalizadas, veja colacao.h)
+ */
+void selecionarTextoRegistros(const void* registros, int n, size_t tamanhoRegistro, size_t deslocamentoCampo,
+                              const char* texto, unsigned long long selecao[]);
+
+/*
+ * Combinações: destino = destino E origem / destino = destino OU origem
+ */
+void intersectarSelecao(unsigned long long destino[], const unsigned long long origem[], int n);
+void unirSelecao(unsigned long long destino[], const unsigned long long origem[], int n);
+
+int contarSelecao(const unsigned long long selecao[], int n);
+
+/*
+ * Primeira posição selecionada a partir de inicio, ou -1
+ * Percorra com: for (i = proximoSelecionado(s, n, 0); i != -1; i = proximoSelecionado(s, n, i + 1))
+ */
+int proximoSelecionado(const unsigned long long selecao[], int n, int inicio);
+
+#endif